@@ -93,7 +93,7 @@ bool FPCGExAssetCollectionToSetElement::ExecuteInternal(FPCGContext* Context) co
 		return OutputToPin();
 	}
 
-	const PCGExAssetCollection::FCache* MainCache = MainCollection->LoadCache();
+	const PCGExAssetCollection::FCache* MainCache = MainCollection->RefreshCache();
 	TArray<const FPCGExAssetCollectionEntry*> Entries;
 
 	const FPCGExAssetCollectionEntry* Entry = nullptr;
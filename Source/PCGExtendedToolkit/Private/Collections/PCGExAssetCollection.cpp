@@ -9,6 +9,69 @@
 
 namespace PCGExAssetCollection
 {
+	void FAliasTable::Build(const TArray<double>& InWeights)
+	{
+		const int32 NumItems = InWeights.Num();
+
+		Probabilities.SetNumUninitialized(NumItems);
+		Aliases.SetNumUninitialized(NumItems);
+
+		double TotalWeight = 0;
+		for (const double Weight : InWeights) { TotalWeight += FMath::Max(0.0, Weight); }
+
+		if (TotalWeight <= 0)
+		{
+			for (int i = 0; i < NumItems; i++)
+			{
+				Probabilities[i] = 1;
+				Aliases[i] = i;
+			}
+			return;
+		}
+
+		// Scale odds so the average column is exactly 1, then pair each underfull column with an overfull one
+		TArray<double> Scaled;
+		Scaled.SetNumUninitialized(NumItems);
+
+		TArray<int32> Small;
+		TArray<int32> Large;
+		Small.Reserve(NumItems);
+		Large.Reserve(NumItems);
+
+		for (int i = 0; i < NumItems; i++)
+		{
+			Scaled[i] = FMath::Max(0.0, InWeights[i]) * NumItems / TotalWeight;
+			if (Scaled[i] < 1) { Small.Add(i); }
+			else { Large.Add(i); }
+		}
+
+		while (!Small.IsEmpty() && !Large.IsEmpty())
+		{
+			const int32 Less = Small.Pop(EAllowShrinking::No);
+			const int32 More = Large.Pop(EAllowShrinking::No);
+
+			Probabilities[Less] = Scaled[Less];
+			Aliases[Less] = More;
+
+			Scaled[More] = (Scaled[More] + Scaled[Less]) - 1;
+			if (Scaled[More] < 1) { Small.Add(More); }
+			else { Large.Add(More); }
+		}
+
+		// Whatever is left is full, give or take floating point error
+		for (const int32 Index : Large)
+		{
+			Probabilities[Index] = 1;
+			Aliases[Index] = Index;
+		}
+
+		for (const int32 Index : Small)
+		{
+			Probabilities[Index] = 1;
+			Aliases[Index] = Index;
+		}
+	}
+
 	void FCategory::RegisterEntry(const int32 Index, const FPCGExAssetCollectionEntry* InEntry)
 	{
 		Entries.Add(InEntry);
@@ -26,10 +89,14 @@ namespace PCGExAssetCollection
 		const int32 NumEntries = Indices.Num();
 		PCGEx::ArrayOfIndices(Order, NumEntries);
 
+		// Weights are left untouched so compiling again yields the same result
 		Order.Sort([&](const int32 A, const int32 B) { return Weights[A] < Weights[B]; });
-		Weights.Sort([&](const int32 A, const int32 B) { return A < B; });
 
-		for (int32 i = 0; i < NumEntries; i++) { Weights[i] = i == 0 ? Weights[i] : Weights[i - 1] + Weights[i]; }
+		TArray<double> PickWeights;
+		PickWeights.SetNumUninitialized(NumEntries);
+		for (int32 i = 0; i < NumEntries; i++) { PickWeights[i] = Weights[i]; }
+
+		WeightedPicks.Build(PickWeights);
 	}
 }
 
@@ -76,6 +143,72 @@ namespace PCGExAssetCollection
 	{
 		Main->Compile();
 		for (const TPair<FName, TSharedPtr<FCategory>>& Pair : Categories) { Pair.Value->Compile(); }
+
+		BuildFlatPicks();
+	}
+
+	bool FCache::IsFlatPicksStale() const
+	{
+		for (const FFlatDependency& Dependency : FlatDependencies)
+		{
+			const UPCGExAssetCollection* Collection = Dependency.Collection.Get();
+			if (!Collection || Collection->GetCacheVersion() != Dependency.Version) { return true; }
+		}
+
+		return false;
+	}
+
+	void FCache::BuildFlatPicks()
+	{
+		bResolving = true;
+
+		TArray<const FPCGExAssetCollectionEntry*> NewEntries;
+		TArray<double> NewWeights;
+		TArray<FFlatDependency> NewDependencies;
+
+		auto AddDependency = [&](const FFlatDependency& InDependency)
+		{
+			for (const FFlatDependency& Dependency : NewDependencies) { if (Dependency.Collection == InDependency.Collection) { return; } }
+			NewDependencies.Add(InDependency);
+		};
+
+		double TotalWeight = 0;
+		for (const int32 Weight : Main->Weights) { TotalWeight += FMath::Max(0, Weight); }
+
+		for (int i = 0; i < Main->Entries.Num(); i++)
+		{
+			const FPCGExAssetCollectionEntry* Entry = Main->Entries[i];
+			const double Odds = TotalWeight > 0 ? FMath::Max(0, Main->Weights[i]) / TotalWeight : 1.0 / Main->Entries.Num();
+
+			if (!Entry->bIsSubCollection)
+			{
+				NewEntries.Add(Entry);
+				NewWeights.Add(Odds);
+				continue;
+			}
+
+			// Sub-collections are loaded & compiled while validating entries, and refreshed here if they went stale;
+			// a collection nested in itself is still resolving and contributes nothing
+			UPCGExAssetCollection* SubCollection = Entry->BaseSubCollectionPtr;
+			const FCache* SubCache = SubCollection ? SubCollection->RefreshCache() : nullptr;
+			if (!SubCache || SubCache == this || SubCache->bResolving) { continue; }
+
+			AddDependency(FFlatDependency{SubCollection, SubCollection->GetCacheVersion()});
+			for (const FFlatDependency& Dependency : SubCache->FlatDependencies) { AddDependency(Dependency); }
+
+			for (int j = 0; j < SubCache->FlatEntries.Num(); j++)
+			{
+				NewEntries.Add(SubCache->FlatEntries[j]);
+				NewWeights.Add(Odds * SubCache->FlatWeights[j]);
+			}
+		}
+
+		FlatEntries = MoveTemp(NewEntries);
+		FlatWeights = MoveTemp(NewWeights);
+		FlatDependencies = MoveTemp(NewDependencies);
+		FlatPicks.Build(FlatWeights);
+
+		bResolving = false;
 	}
 }
 
@@ -89,6 +222,14 @@ PCGExAssetCollection::FCache* UPCGExAssetCollection::LoadCache()
 	return Cache.Get();
 }
 
+PCGExAssetCollection::FCache* UPCGExAssetCollection::RefreshCache()
+{
+	PCGExAssetCollection::FCache* CurrentCache = LoadCache();
+	// Only the flattened picks depend on other collections, so that's all there is to refresh when one of them changes
+	if (!CurrentCache->bResolving && CurrentCache->IsFlatPicksStale()) { CurrentCache->BuildFlatPicks(); }
+	return CurrentCache;
+}
+
 void UPCGExAssetCollection::PostLoad()
 {
 	Super::PostLoad();
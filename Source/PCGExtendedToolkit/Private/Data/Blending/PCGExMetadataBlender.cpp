@@ -75,6 +75,25 @@ namespace PCGExDataBlending
 		PropertiesBlender->BlendRange(*A.Point, *B.Point, View, Weights);
 	}
 
+	void FMetadataBlender::BlendBatch(const TArrayView<FBlendStep>& Steps)
+	{
+		for (FBlendStep& Step : Steps)
+		{
+			Step.bFirstOperation = FirstPointOperation[Step.WriteIndex];
+			FirstPointOperation[Step.WriteIndex] = false;
+		}
+
+		const TArrayView<const FBlendStep> ConstSteps = Steps;
+		for (const TSharedPtr<FDataBlendingOperationBase>& Op : Operations) { Op->DoOperations(ConstSteps); }
+
+		if (bSkipProperties) { return; }
+
+		for (const FBlendStep& Step : Steps)
+		{
+			PropertiesBlender->Blend(*(PrimaryPoints->GetData() + Step.PrimaryIndex), *(SecondaryPoints->GetData() + Step.SecondaryIndex), (*PrimaryPoints)[Step.WriteIndex], Step.Weight);
+		}
+	}
+
 	void FMetadataBlender::CompleteRangeBlending(
 		const int32 StartIndex,
 		const int32 Range,
@@ -199,6 +218,9 @@ namespace PCGExDataBlending
 		OperationsToBeCompleted.Empty(Identities.Num());
 		OperationsToBePrepared.Empty(Identities.Num());
 
+		// Operations are grouped by type & blend mode below, so identical kernels run back to back
+		Identities.StableSort([](const PCGEx::FAttributeIdentity& A, const PCGEx::FAttributeIdentity& B) { return A.UnderlyingType < B.UnderlyingType; });
+
 		for (const PCGEx::FAttributeIdentity& Identity : Identities)
 		{
 			if (IgnoreAttributeSet && IgnoreAttributeSet->Contains(Identity.Name)) { continue; }
@@ -214,13 +236,19 @@ namespace PCGExDataBlending
 			OperationIdMap.Add(Identity.Name, Op.Get());
 
 			Operations.Add(Op);
-			if (Op->GetRequiresPreparation()) { OperationsToBePrepared.Add(Op.Get()); }
-			if (Op->GetRequiresFinalization()) { OperationsToBeCompleted.Add(Op.Get()); }
 
 			if (bSoftMode) { Op->SoftPrepareForData(InPrimaryFacade, InSecondaryFacade, SecondarySource); }
 			else { Op->PrepareForData(InPrimaryFacade, InSecondaryFacade, SecondarySource); }
 		}
 
+		Operations.StableSort([](const TSharedPtr<FDataBlendingOperationBase>& A, const TSharedPtr<FDataBlendingOperationBase>& B) { return A->GetBlendingType() < B->GetBlendingType(); });
+
+		for (const TSharedPtr<FDataBlendingOperationBase>& Op : Operations)
+		{
+			if (Op->GetRequiresPreparation()) { OperationsToBePrepared.Add(Op.Get()); }
+			if (Op->GetRequiresFinalization()) { OperationsToBeCompleted.Add(Op.Get()); }
+		}
+
 		FirstPointOperation.Init(bInitFirstOperation, PrimaryPoints->Num());
 	}
 }
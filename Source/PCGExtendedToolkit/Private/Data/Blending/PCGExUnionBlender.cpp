@@ -167,31 +167,38 @@ namespace PCGExDataBlending
 
 		// Blend Attributes
 
+		TArray<PCGMetadataEntryKey, TInlineAllocator<16>> Keys;
+		Keys.SetNumUninitialized(UnionCount);
+		for (int k = 0; k < UnionCount; k++) { Keys[k] = Sources[IdxIO[k]]->Source->GetInPoint(IdxPt[k]).MetadataEntry; }
+
+		TArray<FUnionSample, TInlineAllocator<16>> Samples;
+
 		for (const TSharedPtr<FAttributeSourceMap>& SrcMap : AttributeSourceMaps)
 		{
 			SrcMap->TargetBlendOp->PrepareOperation(WriteIndex);
 
-			int32 ValidUnions = 0;
+			// All source operations of a map share the same type & writer; any of them can accumulate for the others
+			const FDataBlendingOperationBase* Operation = nullptr;
 			double TotalWeight = 0;
 
+			Samples.Reset();
+
 			for (int k = 0; k < UnionCount; k++)
 			{
-				const TSharedPtr<FDataBlendingOperationBase>& Operation = SrcMap->BlendOps[IdxIO[k]];
-				if (!Operation) { continue; }
+				const TSharedPtr<FDataBlendingOperationBase>& SourceOperation = SrcMap->BlendOps[IdxIO[k]];
+				if (!SourceOperation) { continue; }
 
-				const double Weight = Weights[k];
-
-				Operation->DoOperation(
-					WriteIndex, Sources[IdxIO[k]]->Source->GetInPoint(IdxPt[k]),
-					WriteIndex, Weight, k == 0);
+				if (!Operation) { Operation = SourceOperation.Get(); }
 
-				ValidUnions++;
+				const double Weight = Weights[k];
+				Samples.Add(FUnionSample{SrcMap->Attributes[IdxIO[k]], Keys[k], Weight});
 				TotalWeight += Weight;
 			}
 
-			if (ValidUnions == 0) { continue; } // No valid attribute to merge on any union source
+			if (!Operation) { continue; } // No valid attribute to merge on any union source
 
-			SrcMap->TargetBlendOp->FinalizeOperation(WriteIndex, ValidUnions, TotalWeight);
+			Operation->AccumulateOperation(WriteIndex, Samples, SrcMap->BlendOps[IdxIO[0]].IsValid());
+			SrcMap->TargetBlendOp->FinalizeOperation(WriteIndex, Samples.Num(), TotalWeight);
 		}
 	}
 
@@ -30,15 +30,51 @@ namespace PCGExData
 
 		//UE_LOG(LogTemp, Warning, TEXT("{%lld} Facade -> Write"), AsyncManager->Context->GetInputSettings<UPCGSettings>()->UID)
 
-		for (const TSharedPtr<FBufferBase> Buffer : Buffers)
+		TArray<TSharedPtr<FBufferBase>> Writables;
+		TArray<uint64> Scopes;
+		const int32 NumScopes = GetWriteScopes(Writables, Scopes);
+
+		if (NumScopes > 0)
 		{
-			if (!Buffer.IsValid() || !Buffer->IsWritable()) { continue; }
-			PCGExMT::Write(AsyncManager, Buffer);
+			if (const TSharedPtr<PCGExMT::FTaskGroup> WriteBuffers = AsyncManager->TryCreateGroup(FName("WriteBuffers")))
+			{
+				// One iteration per scope; scopes of all buffers share the pool, and work stealing balances the tail
+				WriteBuffers->OnIterationCallback =
+					[Writables = MoveTemp(Writables), Scopes = MoveTemp(Scopes)](const int32 Index, const int32 Count, const int32 LoopIdx)
+					{
+						const uint64 Scope = Scopes[Index];
+						const TSharedPtr<FBufferBase>& Buffer = Writables[PCGEx::H64A(Scope)];
+						const int32 StartIndex = PCGEx::H64B(Scope);
+						Buffer->WriteRange(StartIndex, FMath::Min(WriteChunkSize, Buffer->GetNumOut() - StartIndex));
+					};
+
+				WriteBuffers->StartIterations(NumScopes, 1, false, false);
+			}
 		}
 
 		Flush();
 	}
 
+	int32 FFacade::GetWriteScopes(TArray<TSharedPtr<FBufferBase>>& OutWritables, TArray<uint64>& OutScopes)
+	{
+		OutWritables.Reset(Buffers.Num());
+		OutScopes.Reset();
+
+		for (const TSharedPtr<FBufferBase>& Buffer : Buffers)
+		{
+			if (!Buffer.IsValid() || !Buffer->IsWritable()) { continue; }
+
+			const int32 WritableIndex = OutWritables.Add(Buffer);
+			const int32 NumOut = Buffer->GetNumOut();
+			for (int32 StartIndex = 0; StartIndex < NumOut; StartIndex += WriteChunkSize) { OutScopes.Add(PCGEx::H64(WritableIndex, StartIndex)); }
+		}
+
+		// Ranges are written concurrently and must not race to create missing entries
+		if (!OutScopes.IsEmpty()) { Source->GetOutKeys(true); }
+
+		return OutScopes.Num();
+	}
+
 	void FFacade::WriteBuffersAsCallbacks(const TSharedPtr<PCGExMT::FTaskGroup>& TaskGroup)
 	{
 		// !!! Requires manual flush !!!
@@ -49,9 +85,17 @@ namespace PCGExData
 			return;
 		}
 
-		for (const TSharedPtr<FBufferBase> Buffer : Buffers)
+		TArray<TSharedPtr<FBufferBase>> Writables;
+		TArray<uint64> Scopes;
+		GetWriteScopes(Writables, Scopes);
+
+		for (const uint64 Scope : Scopes)
 		{
-			if (Buffer->IsWritable()) { TaskGroup->AddSimpleCallback([BufferRef = Buffer]() { BufferRef->Write(); }); }
+			TaskGroup->AddSimpleCallback(
+				[BufferRef = Writables[PCGEx::H64A(Scope)], StartIndex = static_cast<int32>(PCGEx::H64B(Scope))]()
+				{
+					BufferRef->WriteRange(StartIndex, FMath::Min(WriteChunkSize, BufferRef->GetNumOut() - StartIndex));
+				});
 		}
 	}
 
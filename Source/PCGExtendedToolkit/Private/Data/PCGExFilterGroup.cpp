@@ -99,6 +99,58 @@ namespace PCGExFilterGroup
 		return true;
 	}
 
+	void FFilterGroupAND::TestScope(const int32 StartIndex, const int32 Count, uint64* InOutMask) const
+	{
+		const int32 NumWords = PCGExPointFilter::NumMaskWords(Count);
+
+		TArray<uint64, TInlineAllocator<16>> Passing;
+		Passing.Append(InOutMask, NumWords);
+
+		for (const TSharedPtr<PCGExPointFilter::FFilter>& Filter : ManagedFilters)
+		{
+			Filter->TestScope(StartIndex, Count, Passing.GetData());
+
+			uint64 Any = 0;
+			for (int w = 0; w < NumWords; w++) { Any |= Passing[w]; }
+			if (!Any) { break; }
+		}
+
+		if (bInvert) { for (int w = 0; w < NumWords; w++) { InOutMask[w] &= ~Passing[w]; } }
+		else { for (int w = 0; w < NumWords; w++) { InOutMask[w] = Passing[w]; } }
+	}
+
+	void FFilterGroupOR::TestScope(const int32 StartIndex, const int32 Count, uint64* InOutMask) const
+	{
+		const int32 NumWords = PCGExPointFilter::NumMaskWords(Count);
+
+		// Only indices that haven't passed any filter yet are tested against the next one
+		TArray<uint64, TInlineAllocator<16>> Pending;
+		TArray<uint64, TInlineAllocator<16>> Passing;
+		TArray<uint64, TInlineAllocator<16>> Tested;
+		Pending.Append(InOutMask, NumWords);
+		Passing.Init(0, NumWords);
+		Tested.SetNumUninitialized(NumWords);
+
+		for (const TSharedPtr<PCGExPointFilter::FFilter>& Filter : ManagedFilters)
+		{
+			FMemory::Memcpy(Tested.GetData(), Pending.GetData(), NumWords * sizeof(uint64));
+			Filter->TestScope(StartIndex, Count, Tested.GetData());
+
+			uint64 Any = 0;
+			for (int w = 0; w < NumWords; w++)
+			{
+				Passing[w] |= Tested[w];
+				Pending[w] &= ~Tested[w];
+				Any |= Pending[w];
+			}
+
+			if (!Any) { break; }
+		}
+
+		if (bInvert) { for (int w = 0; w < NumWords; w++) { InOutMask[w] &= ~Passing[w]; } }
+		else { for (int w = 0; w < NumWords; w++) { InOutMask[w] = Passing[w]; } }
+	}
+
 	void FFilterGroup::PostInitManagedFilter(const FPCGContext* InContext, const TSharedPtr<PCGExPointFilter::FFilter>& InFilter)
 	{
 		InFilter->PostInit();
@@ -36,6 +36,25 @@ namespace PCGExPointFilter
 	bool FFilter::Test(const PCGExCluster::FNode& Node) const { return Test(Node.PointIndex); }
 	bool FFilter::Test(const PCGExGraph::FIndexedEdge& Edge) const { return Test(Edge.PointIndex); }
 
+	void FFilter::TestScope(const int32 StartIndex, const int32 Count, uint64* InOutMask) const
+	{
+		const int32 NumWords = NumMaskWords(Count);
+		for (int w = 0; w < NumWords; w++)
+		{
+			uint64 Word = InOutMask[w];
+			uint64 Pending = Word;
+
+			while (Pending)
+			{
+				const int32 Bit = FMath::CountTrailingZeros64(Pending);
+				Pending &= Pending - 1;
+				if (!Test(StartIndex + (w << 6) + Bit)) { Word &= ~(1ULL << Bit); }
+			}
+
+			InOutMask[w] = Word;
+		}
+	}
+
 	bool FSimpleFilter::Test(const int32 Index) const PCGEX_NOT_IMPLEMENTED_RET(TEdgeFilter::Test(const PCGExCluster::FNode& Node), false)
 	bool FSimpleFilter::Test(const PCGExCluster::FNode& Node) const { return Test(Node.PointIndex); }
 	bool FSimpleFilter::Test(const PCGExGraph::FIndexedEdge& Edge) const { return Test(Edge.PointIndex); }
@@ -64,6 +83,53 @@ namespace PCGExPointFilter
 		return true;
 	}
 
+	void FManager::TestScope(const int32 StartIndex, const int32 Count, uint64* InOutMask)
+	{
+		const int32 NumWords = NumMaskWords(Count);
+
+		for (const TSharedPtr<FFilter>& Handler : ManagedFilters)
+		{
+			Handler->TestScope(StartIndex, Count, InOutMask);
+
+			uint64 Any = 0;
+			for (int w = 0; w < NumWords; w++) { Any |= InOutMask[w]; }
+			if (!Any) { return; }
+		}
+	}
+
+	void FManager::TestScopePerIndex(const int32 StartIndex, const int32 Count, uint64* InOutMask)
+	{
+		const int32 NumWords = NumMaskWords(Count);
+		for (int w = 0; w < NumWords; w++)
+		{
+			uint64 Word = InOutMask[w];
+			uint64 Pending = Word;
+
+			while (Pending)
+			{
+				const int32 Bit = FMath::CountTrailingZeros64(Pending);
+				Pending &= Pending - 1;
+				if (!Test(StartIndex + (w << 6) + Bit)) { Word &= ~(1ULL << Bit); }
+			}
+
+			InOutMask[w] = Word;
+		}
+	}
+
+	void FManager::TestScope(const int32 StartIndex, const int32 Count, TArray<bool>& OutResults)
+	{
+		const int32 NumWords = NumMaskWords(Count);
+
+		TArray<uint64, TInlineAllocator<16>> Mask;
+		Mask.Init(MAX_uint64, NumWords);
+		if (const int32 Tail = Count & 63) { Mask.Last() = (1ULL << Tail) - 1; }
+
+		TestScope(StartIndex, Count, Mask.GetData());
+
+		bool* Out = OutResults.GetData() + StartIndex;
+		for (int i = 0; i < Count; i++) { Out[i] = (Mask[i >> 6] >> (i & 63)) & 1; }
+	}
+
 	bool FManager::Test(const PCGExCluster::FNode& Node)
 	{
 		for (const TSharedPtr<FFilter>& Handler : ManagedFilters) { if (!Handler->Test(Node)) { return false; } }
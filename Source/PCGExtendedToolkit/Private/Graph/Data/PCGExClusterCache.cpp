@@ -0,0 +1,258 @@
+﻿// Copyright Timothé Lapetite 2024
+// Released under the MIT license https://opensource.org/license/MIT/
+
+
+#include "Graph/Data/PCGExClusterCache.h"
+
+#include "PCGComponent.h"
+#include "PCGContext.h"
+#include "PCGExGlobalSettings.h"
+#include "UPCGExSubSystem.h"
+#include "Data/PCGExPointIO.h"
+#include "Graph/PCGExCluster.h"
+#include "Hash/CityHash.h"
+
+namespace PCGExClusterCache
+{
+	TSharedPtr<PCGExCluster::FCluster> FCache::Find(const uint64 Key)
+	{
+		FWriteScopeLock WriteScopeLock(CacheLock);
+
+		FEntry* Entry = Entries.Find(Key);
+		if (!Entry)
+		{
+			Stats.Misses++;
+			return nullptr;
+		}
+
+		Stats.Hits++;
+		Entry->LastUsed = ++Tick;
+		return Entry->Cluster;
+	}
+
+	void FCache::Add(const uint64 Key, const TSharedRef<PCGExCluster::FCluster>& InCluster)
+	{
+		const int64 Bytes = EstimateSize(*InCluster);
+
+		FWriteScopeLock WriteScopeLock(CacheLock);
+
+		if (Bytes > BudgetBytes) { return; } // Would evict everything and still not fit
+
+		if (const FEntry* Existing = Entries.Find(Key)) { UsedBytes -= Existing->Bytes; } // Built concurrently from identical data; keep the latest
+
+		FEntry& Entry = Entries.FindOrAdd(Key);
+		Entry.Cluster = InCluster;
+		Entry.Bytes = Bytes;
+		Entry.LastUsed = ++Tick;
+
+		UsedBytes += Bytes;
+		Stats.Insertions++;
+
+		EvictUnsafe(BudgetBytes);
+	}
+
+	void FCache::Harvest(const uint64 Key, const TSharedRef<PCGExCluster::FCluster>& InMirror)
+	{
+		FWriteScopeLock WriteScopeLock(CacheLock);
+
+		FEntry* Entry = Entries.Find(Key);
+		if (!Entry) { return; }
+
+		const PCGExCluster::FCluster& Cached = *Entry->Cluster;
+
+		// Expanded items & octree items point into nodes & edges, so only adopt them from a mirror that didn't copy either
+		if (Cached.Nodes != InMirror->Nodes || Cached.Edges != InMirror->Edges) { return; }
+
+		bool bAdopt = false;
+
+#define PCGEX_HARVEST(_NAME) bAdopt |= !Cached._NAME && InMirror->_NAME;
+		PCGEX_HARVEST(ExpandedNodes)
+		PCGEX_HARVEST(ExpandedEdges)
+		PCGEX_HARVEST(NodeOctree)
+		PCGEX_HARVEST(EdgeOctree)
+#undef PCGEX_HARVEST
+
+		if (!bAdopt) { return; }
+
+		// The published cluster may be mirrored concurrently, outside the cache lock; publish a replacement instead of mutating it
+		const TSharedPtr<PCGExCluster::FCluster> Replacement = MakeShared<PCGExCluster::FCluster>(Cached);
+
+#define PCGEX_HARVEST(_NAME) if (!Replacement->_NAME) { Replacement->_NAME = InMirror->_NAME; }
+		PCGEX_HARVEST(ExpandedNodes)
+		PCGEX_HARVEST(ExpandedEdges)
+		PCGEX_HARVEST(NodeOctree)
+		PCGEX_HARVEST(EdgeOctree)
+#undef PCGEX_HARVEST
+
+		Entry->Cluster = Replacement;
+
+		const int64 Bytes = EstimateSize(*Replacement);
+		UsedBytes += Bytes - Entry->Bytes;
+		Entry->Bytes = Bytes;
+
+		EvictUnsafe(BudgetBytes);
+	}
+
+	void FCache::EvictUnsafe(const int64 InBudgetBytes)
+	{
+		// Entries are whole clusters, there are few enough of them that a scan beats maintaining a list
+		while (UsedBytes > InBudgetBytes && !Entries.IsEmpty())
+		{
+			uint64 OldestKey = 0;
+			uint64 OldestTick = MAX_uint64;
+
+			for (const TPair<uint64, FEntry>& Pair : Entries)
+			{
+				if (Pair.Value.LastUsed >= OldestTick) { continue; }
+				OldestTick = Pair.Value.LastUsed;
+				OldestKey = Pair.Key;
+			}
+
+			FEntry Evicted;
+			Entries.RemoveAndCopyValue(OldestKey, Evicted);
+			UsedBytes -= Evicted.Bytes;
+			Stats.Evictions++;
+		}
+	}
+
+	void FCache::SetBudget(const int64 InBudgetBytes)
+	{
+		FWriteScopeLock WriteScopeLock(CacheLock);
+		BudgetBytes = InBudgetBytes;
+		EvictUnsafe(BudgetBytes);
+	}
+
+	void FCache::Empty()
+	{
+		FWriteScopeLock WriteScopeLock(CacheLock);
+		Entries.Empty();
+		UsedBytes = 0;
+	}
+
+	FStats FCache::GetStats() const
+	{
+		FReadScopeLock ReadScopeLock(CacheLock);
+
+		FStats OutStats = Stats;
+		OutStats.NumEntries = Entries.Num();
+		OutStats.UsedBytes = UsedBytes;
+		OutStats.BudgetBytes = BudgetBytes;
+		return OutStats;
+	}
+
+	uint64 ComputeKey(const TSharedRef<PCGExData::FPointIO>& InVtxIO, const TSharedRef<PCGExData::FPointIO>& InEdgesIO, const bool bIsOneToOne)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusterCache::ComputeKey);
+
+		const UPCGPointData* VtxData = InVtxIO->GetIn();
+		const UPCGPointData* EdgesData = InEdgesIO->GetIn();
+		if (!VtxData || !EdgesData) { return 0; }
+
+		const FPCGMetadataAttribute<int64>* VtxEndpoints = VtxData->Metadata->GetConstTypedAttribute<int64>(PCGExGraph::Tag_VtxEndpoint);
+		const FPCGMetadataAttribute<int64>* EdgeEndpoints = EdgesData->Metadata->GetConstTypedAttribute<int64>(PCGExGraph::Tag_EdgeEndpoints);
+		if (!VtxEndpoints || !EdgeEndpoints) { return 0; }
+
+		const TArray<FPCGPoint>& VtxPoints = VtxData->GetPoints();
+		const TArray<FPCGPoint>& EdgePoints = EdgesData->GetPoints();
+
+		uint64 Hash = CityHash64WithSeed(
+			nullptr, 0,
+			PCGEx::H64(VtxPoints.Num(), EdgePoints.Num()) ^
+			PCGEx::H64(InEdgesIO->IOIndex, (bIsOneToOne ? 1 : 0) | (GetDefault<UPCGExGlobalSettings>()->bBuildAdjacencyCSR ? 2 : 0)));
+
+		// Points are hashed by value rather than raw memory, which carries padding & metadata keys
+		constexpr int32 ValuesPerVtx = 17;
+		constexpr int32 ChunkSize = 1024;
+
+		TArray<double> Chunk;
+		Chunk.SetNumUninitialized(ChunkSize * ValuesPerVtx);
+
+		for (int Start = 0; Start < VtxPoints.Num(); Start += ChunkSize)
+		{
+			const int32 Count = FMath::Min(ChunkSize, VtxPoints.Num() - Start);
+			double* Write = Chunk.GetData();
+
+			for (int i = 0; i < Count; i++)
+			{
+				const FPCGPoint& Point = VtxPoints[Start + i];
+				const FVector Location = Point.Transform.GetLocation();
+				const FQuat Rotation = Point.Transform.GetRotation();
+				const FVector Scale = Point.Transform.GetScale3D();
+
+				*Write++ = Location.X;
+				*Write++ = Location.Y;
+				*Write++ = Location.Z;
+				*Write++ = Rotation.X;
+				*Write++ = Rotation.Y;
+				*Write++ = Rotation.Z;
+				*Write++ = Rotation.W;
+				*Write++ = Scale.X;
+				*Write++ = Scale.Y;
+				*Write++ = Scale.Z;
+				*Write++ = Point.BoundsMin.X;
+				*Write++ = Point.BoundsMin.Y;
+				*Write++ = Point.BoundsMin.Z;
+				*Write++ = Point.BoundsMax.X;
+				*Write++ = Point.BoundsMax.Y;
+				*Write++ = Point.BoundsMax.Z;
+				*Write++ = static_cast<double>(VtxEndpoints->GetValueFromItemKey(Point.MetadataEntry));
+			}
+
+			Hash = CityHash64WithSeed(reinterpret_cast<const char*>(Chunk.GetData()), Count * ValuesPerVtx * sizeof(double), Hash);
+		}
+
+		TArray<int64> EndpointsChunk;
+		EndpointsChunk.SetNumUninitialized(ChunkSize);
+
+		for (int Start = 0; Start < EdgePoints.Num(); Start += ChunkSize)
+		{
+			const int32 Count = FMath::Min(ChunkSize, EdgePoints.Num() - Start);
+			for (int i = 0; i < Count; i++) { EndpointsChunk[i] = EdgeEndpoints->GetValueFromItemKey(EdgePoints[Start + i].MetadataEntry); }
+			Hash = CityHash64WithSeed(reinterpret_cast<const char*>(EndpointsChunk.GetData()), Count * sizeof(int64), Hash);
+		}
+
+		return Hash == 0 ? 1 : Hash; // 0 is reserved for "no key"
+	}
+
+	int64 EstimateSize(const PCGExCluster::FCluster& InCluster)
+	{
+		int64 Bytes = sizeof(PCGExCluster::FCluster);
+
+		if (InCluster.Nodes)
+		{
+			Bytes += InCluster.Nodes->GetAllocatedSize();
+			for (const PCGExCluster::FNode& Node : *InCluster.Nodes) { Bytes += Node.Adjacency.GetAllocatedSize(); }
+		}
+
+		if (InCluster.Edges) { Bytes += InCluster.Edges->GetAllocatedSize(); }
+		if (InCluster.NodeIndexLookup) { Bytes += InCluster.NodeIndexLookup->Num() * sizeof(int32) * 2; }
+		if (InCluster.AdjacencyCSR) { Bytes += InCluster.AdjacencyCSR->Links.GetAllocatedSize() + InCluster.AdjacencyCSR->Offsets.GetAllocatedSize(); }
+		Bytes += InCluster.NodePositions.GetAllocatedSize();
+
+		if (InCluster.ExpandedNodes)
+		{
+			Bytes += InCluster.ExpandedNodes->GetAllocatedSize();
+			for (const PCGExCluster::FExpandedNode& ExpandedNode : *InCluster.ExpandedNodes) { Bytes += ExpandedNode.Neighbors.GetAllocatedSize(); }
+		}
+
+		if (InCluster.ExpandedEdges) { Bytes += InCluster.ExpandedEdges->GetAllocatedSize(); }
+
+		// Octree internals aren't exposed; budget a node-sized element per item
+		constexpr int64 OctreeItemBytes = 64;
+		if (InCluster.NodeOctree && InCluster.Nodes) { Bytes += InCluster.Nodes->Num() * OctreeItemBytes; }
+		if (InCluster.EdgeOctree && InCluster.Edges) { Bytes += InCluster.Edges->Num() * OctreeItemBytes; }
+
+		return Bytes;
+	}
+
+	TSharedPtr<FCache> GetCache(const FPCGContext* InContext)
+	{
+		if (!InContext || !GetDefault<UPCGExGlobalSettings>()->bPersistentClusterCache) { return nullptr; }
+
+		const UPCGComponent* SourceComponent = InContext->SourceComponent.Get();
+		const UWorld* World = SourceComponent ? SourceComponent->GetWorld() : nullptr;
+		UPCGExSubSystem* SubSystem = World ? World->GetSubsystem<UPCGExSubSystem>() : nullptr;
+
+		return SubSystem ? SubSystem->GetClusterCache() : nullptr;
+	}
+}
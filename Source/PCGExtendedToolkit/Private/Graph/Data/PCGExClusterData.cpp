@@ -61,6 +61,7 @@ void UPCGExClusterEdgesData::InitializeFromPCGExData(const UPCGExPointData* InPC
 				InitMode != PCGExData::EInit::NewOutput)
 			{
 				SetBoundCluster(InEdgeData->Cluster);
+				SetBoundLandmarks(InEdgeData->Landmarks);
 			}
 		}
 	}
@@ -76,6 +77,16 @@ const TSharedPtr<PCGExCluster::FCluster>& UPCGExClusterEdgesData::GetBoundCluste
 	return Cluster;
 }
 
+void UPCGExClusterEdgesData::SetBoundLandmarks(const TSharedPtr<PCGExHeuristics::FLandmarks>& InLandmarks)
+{
+	Landmarks = InLandmarks;
+}
+
+const TSharedPtr<PCGExHeuristics::FLandmarks>& UPCGExClusterEdgesData::GetBoundLandmarks() const
+{
+	return Landmarks;
+}
+
 #if PCGEX_ENGINE_VERSION < 505
 UPCGSpatialData* UPCGExClusterEdgesData::CopyInternal() const
 {
@@ -101,4 +112,5 @@ void UPCGExClusterEdgesData::BeginDestroy()
 {
 	Super::BeginDestroy();
 	Cluster.Reset();
+	Landmarks.Reset();
 }
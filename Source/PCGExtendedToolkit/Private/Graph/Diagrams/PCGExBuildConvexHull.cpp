@@ -96,7 +96,7 @@ namespace PCGExConvexHull
 		ActivePositions.Empty();
 
 		PointDataFacade->Source->InitializeOutput(Context, PCGExData::EInit::DuplicateInput);
-		Edges = Delaunay->DelaunayEdges.Array();
+		Edges = Delaunay->DelaunayEdges;
 
 		GraphBuilder = MakeShared<PCGExGraph::FGraphBuilder>(PointDataFacade, &Settings->GraphBuilderDetails);
 		StartParallelLoopForRange(Edges.Num());
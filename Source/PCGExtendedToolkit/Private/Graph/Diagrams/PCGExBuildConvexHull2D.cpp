@@ -155,7 +155,7 @@ namespace PCGExConvexHull2D
 		ActivePositions.Empty();
 
 		PointDataFacade->Source->InitializeOutput(Context, PCGExData::EInit::DuplicateInput);
-		Edges = Delaunay->DelaunayEdges.Array();
+		Edges = Delaunay->DelaunayEdges;
 
 		GraphBuilder = MakeShared<PCGExGraph::FGraphBuilder>(PointDataFacade, &Settings->GraphBuilderDetails);
 		StartParallelLoopForRange(Edges.Num());
@@ -140,7 +140,8 @@ namespace PCGExBuildDelaunay2D
 		}
 
 		GraphBuilder = MakeShared<PCGExGraph::FGraphBuilder>(PointDataFacade, &Settings->GraphBuilderDetails);
-		GraphBuilder->Graph->InsertEdges(Delaunay->DelaunayEdges, -1);
+		// Delaunay edges are sorted & unique already, no need to deduplicate them again
+		GraphBuilder->Graph->AppendUniqueEdges(Delaunay->DelaunayEdges, -1);
 		GraphBuilder->CompileAsync(AsyncManager, false);
 
 		if (!Settings->bMarkHull && !Settings->bOutputSites) { Delaunay.Reset(); }
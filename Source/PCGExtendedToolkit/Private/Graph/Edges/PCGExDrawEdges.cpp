@@ -78,7 +78,7 @@ bool FPCGExDrawEdgesElement::ExecuteInternal(
 				             PCGExMath::Lerp(Settings->Color, Settings->SecondaryColor, L) :
 				             Settings->Color;
 
-			const TMap<int32, int32>& NodeIndexLookupRef = *Context->CurrentCluster->NodeIndexLookup;
+			const PCGExCluster::FNodeIndexLookup& NodeIndexLookupRef = *Context->CurrentCluster->NodeIndexLookup;
 
 			for (const PCGExGraph::FIndexedEdge& Edge : (*Context->CurrentCluster->Edges))
 			{
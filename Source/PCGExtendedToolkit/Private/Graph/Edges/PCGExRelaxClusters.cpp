@@ -88,19 +88,10 @@ namespace PCGExRelaxClusters
 
 		for (int i = 0; i < NumNodes; i++) { PBufferRef[i] = SBufferRef[i] = Cluster->GetPos(i); }
 
-		ExpandedNodes = Cluster->ExpandedNodes;
 		Iterations = Settings->Iterations;
 
-		if (!ExpandedNodes)
-		{
-			ExpandedNodes = Cluster->GetExpandedNodes(false);
-			bBuildExpandedNodes = true;
-			StartParallelLoopForRange(NumNodes);
-		}
-		else
-		{
-			StartRelaxIteration();
-		}
+		// Relaxing walks the cluster' compact adjacency directly, no need for expanded nodes
+		StartRelaxIteration();
 
 		return true;
 	}
@@ -122,14 +113,9 @@ namespace PCGExRelaxClusters
 			nullptr, SharedThis(this));
 	}
 
-	void FProcessor::ProcessSingleRangeIteration(const int32 Iteration, const int32 LoopIdx, const int32 Count)
-	{
-		*(ExpandedNodes->GetData() + Iteration) = PCGExCluster::FExpandedNode(Cluster, Iteration);
-	}
-
 	void FProcessor::ProcessSingleNode(const int32 Index, PCGExCluster::FNode& Node, const int32 LoopIdx, const int32 Count)
 	{
-		RelaxOperation->ProcessExpandedNode(*(ExpandedNodes->GetData() + Index));
+		RelaxOperation->ProcessNode(Index);
 
 		if (!InfluenceDetails.bProgressiveInfluence) { return; }
 
@@ -139,12 +125,6 @@ namespace PCGExRelaxClusters
 			InfluenceDetails.GetInfluence(Node.PointIndex));
 	}
 
-	void FProcessor::CompleteWork()
-	{
-		if (!bBuildExpandedNodes) { return; }
-		StartRelaxIteration();
-	}
-
 	void FProcessor::Write()
 	{
 		FClusterProcessor::Write();
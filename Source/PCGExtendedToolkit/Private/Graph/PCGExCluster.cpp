@@ -61,12 +61,84 @@ namespace PCGExCluster
 
 #pragma endregion
 
+#pragma region FNodeIndexLookup
+
+	void FNodeIndexLookup::Init(const int32 InNumPoints, const int32 InExpectedNodes)
+	{
+		// A flat int32 per point beats a hashed entry per node as soon as a fair share of the points are nodes
+		bDense = InExpectedNodes * 4 >= InNumPoints;
+		NumEntries = 0;
+
+		Sparse.Empty();
+		Dense.Empty();
+
+		if (bDense)
+		{
+			Dense.SetNumUninitialized(InNumPoints);
+			for (int i = 0; i < InNumPoints; i++) { Dense[i] = -1; }
+		}
+		else
+		{
+			Sparse.Reserve(InExpectedNodes);
+		}
+	}
+
+	void FNodeIndexLookup::Reserve(const int32 InNum)
+	{
+		if (bDense) { Dense.Reserve(InNum); }
+		else { Sparse.Reserve(InNum); }
+	}
+
+	void FNodeIndexLookup::Empty()
+	{
+		NumEntries = 0;
+		Dense.Empty();
+		Sparse.Empty();
+	}
+
+	void FNodeIndexLookup::Shrink()
+	{
+		if (bDense) { Dense.Shrink(); }
+		else { Sparse.Shrink(); }
+	}
+
+#pragma endregion
+
+#pragma region FAdjacencyCSR
+
+	void FAdjacencyCSR::Build(const TArray<FNode>& InNodes)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FAdjacencyCSR::Build);
+
+		const int32 NumNodes = InNodes.Num();
+
+		Offsets.SetNumUninitialized(NumNodes + 1);
+
+		int32 NumLinks = 0;
+		for (int i = 0; i < NumNodes; i++)
+		{
+			Offsets[i] = NumLinks;
+			NumLinks += InNodes[i].Adjacency.Num();
+		}
+		Offsets[NumNodes] = NumLinks;
+
+		Links.SetNumUninitialized(NumLinks);
+		for (int i = 0; i < NumNodes; i++)
+		{
+			const TArray<uint64>& Adjacency = InNodes[i].Adjacency;
+			if (Adjacency.IsEmpty()) { continue; }
+			FMemory::Memcpy(Links.GetData() + Offsets[i], Adjacency.GetData(), Adjacency.Num() * sizeof(uint64));
+		}
+	}
+
+#pragma endregion
+
 #pragma region FCluster
 
 	FCluster::FCluster(const TSharedPtr<PCGExData::FPointIO>& InVtxIO, const TSharedPtr<PCGExData::FPointIO>& InEdgesIO):
 		VtxIO(InVtxIO), EdgesIO(InEdgesIO)
 	{
-		NodeIndexLookup = MakeShared<TMap<int32, int32>>();
+		NodeIndexLookup = MakeShared<FNodeIndexLookup>();
 		Nodes = MakeShared<TArray<FNode>>();
 		Edges = MakeShared<TArray<PCGExGraph::FIndexedEdge>>();
 		Bounds = FBox(ForceInit);
@@ -74,6 +146,34 @@ namespace PCGExCluster
 		VtxPoints = &InVtxIO->GetPoints(PCGExData::ESource::In);
 	}
 
+	FCluster::FCluster(const FCluster& OtherCluster):
+		bIsMirror(OtherCluster.bIsMirror),
+		bEdgeLengthsDirty(OtherCluster.bEdgeLengthsDirty),
+		bIsCopyCluster(OtherCluster.bIsCopyCluster),
+		VtxPointIndices(OtherCluster.VtxPointIndices),
+		VtxPointScopes(OtherCluster.VtxPointScopes),
+		NumRawVtx(OtherCluster.NumRawVtx),
+		NumRawEdges(OtherCluster.NumRawEdges),
+		bValid(OtherCluster.bValid),
+		bIsOneToOne(OtherCluster.bIsOneToOne),
+		ClusterID(OtherCluster.ClusterID),
+		NodeIndexLookup(OtherCluster.NodeIndexLookup),
+		Nodes(OtherCluster.Nodes),
+		ExpandedNodes(OtherCluster.ExpandedNodes),
+		ExpandedEdges(OtherCluster.ExpandedEdges),
+		Edges(OtherCluster.Edges),
+		EdgeLengths(OtherCluster.EdgeLengths),
+		NodePositions(OtherCluster.NodePositions),
+		AdjacencyCSR(OtherCluster.AdjacencyCSR),
+		Bounds(OtherCluster.Bounds),
+		VtxPoints(OtherCluster.VtxPoints),
+		VtxIO(OtherCluster.VtxIO),
+		EdgesIO(OtherCluster.EdgesIO),
+		NodeOctree(OtherCluster.NodeOctree),
+		EdgeOctree(OtherCluster.EdgeOctree)
+	{
+	}
+
 	FCluster::FCluster(const TSharedRef<FCluster>& OtherCluster,
 	                   const TSharedPtr<PCGExData::FPointIO>& InVtxIO,
 	                   const TSharedPtr<PCGExData::FPointIO>& InEdgesIO,
@@ -102,6 +202,7 @@ namespace PCGExCluster
 		else
 		{
 			Nodes = OtherCluster->Nodes;
+			AdjacencyCSR = OtherCluster->AdjacencyCSR; // Copied nodes may be edited, shared ones won't
 		}
 
 		UpdatePositions();
@@ -121,8 +222,7 @@ namespace PCGExCluster
 
 		if (bCopyLookup)
 		{
-			NodeIndexLookup = MakeShared<TMap<int32, int32>>();
-			NodeIndexLookup->Append(*OtherCluster->NodeIndexLookup);
+			NodeIndexLookup = MakeShared<FNodeIndexLookup>(*OtherCluster->NodeIndexLookup);
 		}
 		else
 		{
@@ -146,6 +246,48 @@ namespace PCGExCluster
 		EdgeOctree = OtherCluster->EdgeOctree;
 	}
 
+	FCluster::FCluster(const TSharedRef<FCluster>& OtherCluster,
+	                   const TSharedPtr<PCGExData::FPointIO>& InVtxIO,
+	                   const TSharedPtr<PCGExData::FPointIO>& InEdgesIO,
+	                   const FTransform& InTransform):
+		VtxIO(InVtxIO), EdgesIO(InEdgesIO)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FCluster::TransformedClone);
+
+		// Transformed points live in the output, and that's what this cluster describes
+		VtxPoints = &InVtxIO->GetPoints(PCGExData::ESource::Out);
+
+		bIsMirror = true;
+		bIsCopyCluster = false;
+
+		NumRawVtx = InVtxIO->GetNum(PCGExData::ESource::Out);
+		NumRawEdges = InEdgesIO->GetNum(PCGExData::ESource::Out);
+
+		Nodes = OtherCluster->Nodes;
+		Edges = OtherCluster->Edges;
+		NodeIndexLookup = OtherCluster->NodeIndexLookup;
+		VtxPointIndices = OtherCluster->VtxPointIndices;
+		VtxPointScopes = OtherCluster->VtxPointScopes;
+
+		// Transforming existing positions doesn't depend on the points being transformed yet
+		const int32 NumNodes = OtherCluster->NodePositions.Num();
+		NodePositions.SetNumUninitialized(NumNodes);
+
+		Bounds = FBox(ForceInit);
+		for (int i = 0; i < NumNodes; i++)
+		{
+			const FVector Pos = InTransform.TransformPosition(OtherCluster->NodePositions[i]);
+			NodePositions[i] = Pos;
+			Bounds += Pos;
+		}
+
+		Bounds = Bounds.ExpandBy(10);
+
+		AdjacencyCSR = OtherCluster->AdjacencyCSR;
+
+		// Octrees, expanded nodes & edges and edge lengths are left out, they'll be rebuilt from the new positions if needed
+	}
+
 	void FCluster::ClearInheritedForChanges(const bool bClearOwned)
 	{
 		WillModifyVtxIO(bClearOwned);
@@ -187,7 +329,6 @@ namespace PCGExCluster
 
 		Nodes->Empty();
 		Edges->Empty();
-		NodeIndexLookup->Empty();
 
 		const TUniquePtr<PCGExData::TBuffer<int64>> EndpointsBuffer = MakeUnique<PCGExData::TBuffer<int64>>(PinnedEdgesIO.ToSharedRef(), PCGExGraph::Tag_EdgeEndpoints);
 		if (!EndpointsBuffer->PrepareRead()) { return false; }
@@ -206,9 +347,13 @@ namespace PCGExCluster
 
 		PCGEx::InitArray(Edges, NumEdges);
 		Nodes->Reserve(InNodePoints.Num());
-		NodeIndexLookup->Reserve(InNodePoints.Num());
+		NodeIndexLookup->Init(InNodePoints.Num(), InNodePoints.Num());
 		const TArray<int64>& Endpoints = *EndpointsBuffer->GetInValues().Get();
 
+		// First pass resolves endpoints & counts degrees, so adjacency can be allocated exactly once per node
+		TArray<int32> Degrees;
+		Degrees.SetNumZeroed(InNodePoints.Num());
+
 		for (int i = 0; i < NumEdges; i++)
 		{
 			uint32 A;
@@ -220,13 +365,24 @@ namespace PCGExCluster
 
 			if ((!StartPointIndexPtr || !EndPointIndexPtr)) { return OnFail(); }
 
-			FNode& StartNode = GetOrCreateNodeUnsafe(InNodePoints, *StartPointIndexPtr);
-			FNode& EndNode = GetOrCreateNodeUnsafe(InNodePoints, *EndPointIndexPtr);
+			Degrees[*StartPointIndexPtr]++;
+			Degrees[*EndPointIndexPtr]++;
+
+			(*Edges)[i] = PCGExGraph::FIndexedEdge(i, *StartPointIndexPtr, *EndPointIndexPtr, i, PinnedEdgesIO->IOIndex);
+		}
+
+		for (int i = 0; i < NumEdges; i++)
+		{
+			const PCGExGraph::FIndexedEdge& Edge = *(Edges->GetData() + i);
+
+			FNode& StartNode = GetOrCreateNodeUnsafe(InNodePoints, Edge.Start);
+			FNode& EndNode = GetOrCreateNodeUnsafe(InNodePoints, Edge.End);
+
+			if (StartNode.Adjacency.IsEmpty()) { StartNode.Adjacency.Reserve(Degrees[Edge.Start]); }
+			if (EndNode.Adjacency.IsEmpty()) { EndNode.Adjacency.Reserve(Degrees[Edge.End]); }
 
 			StartNode.Add(EndNode, i);
 			EndNode.Add(StartNode, i);
-
-			(*Edges)[i] = PCGExGraph::FIndexedEdge(i, *StartPointIndexPtr, *EndPointIndexPtr, i, PinnedEdgesIO->IOIndex);
 		}
 
 		if (InExpectedAdjacency)
@@ -245,6 +401,8 @@ namespace PCGExCluster
 
 		Bounds = Bounds.ExpandBy(10);
 
+		if (GetDefault<UPCGExGlobalSettings>()->bBuildAdjacencyCSR) { CreateAdjacencyCSR(); }
+
 		return true;
 	}
 
@@ -259,6 +417,7 @@ namespace PCGExCluster
 
 		const TArray<FPCGPoint>& SubVtxPoints = SubGraph->VtxDataFacade->Source->GetOutIn()->GetPoints();
 		Nodes->Reserve(SubGraph->Nodes.Num());
+		NodeIndexLookup->Init(SubVtxPoints.Num(), SubGraph->Nodes.Num());
 
 		Edges->Reserve(NumRawEdges);
 		Edges->Append(SubGraph->FlattenedEdges);
@@ -273,6 +432,8 @@ namespace PCGExCluster
 		}
 
 		Bounds = Bounds.ExpandBy(10);
+
+		if (GetDefault<UPCGExGlobalSettings>()->bBuildAdjacencyCSR) { CreateAdjacencyCSR(); }
 	}
 
 	bool FCluster::IsValidWith(const TSharedRef<PCGExData::FPointIO>& InVtxIO, const TSharedRef<PCGExData::FPointIO>& InEdgesIO) const
@@ -320,6 +481,17 @@ namespace PCGExCluster
 		return MakeArrayView(VtxPointScopes->GetData(), VtxPointScopes->Num());
 	}
 
+	TSharedPtr<FAdjacencyCSR> FCluster::GetAdjacencyCSR()
+	{
+		{
+			FReadScopeLock ReadScopeLock(ClusterLock);
+			if (AdjacencyCSR) { return AdjacencyCSR; }
+		}
+
+		CreateAdjacencyCSR();
+		return AdjacencyCSR;
+	}
+
 	void FCluster::RebuildNodeOctree()
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FCluster::RebuildNodeOctree);
@@ -440,7 +612,7 @@ namespace PCGExCluster
 
 		const TArray<FNode>& NodesRef = *Nodes;
 		const TArray<PCGExGraph::FIndexedEdge>& EdgesRef = *Edges;
-		const TMap<int32, int32>& NodeIndexLookupRef = *NodeIndexLookup;
+		const FNodeIndexLookup& NodeIndexLookupRef = *NodeIndexLookup;
 
 		if (EdgeOctree)
 		{
@@ -650,7 +822,7 @@ namespace PCGExCluster
 
 		const TArray<FNode>& NodesRef = *Nodes;
 		const TArray<PCGExGraph::FIndexedEdge>& EdgesRef = *Edges;
-		const TMap<int32, int32>& NodeIndexLookupRef = *NodeIndexLookup;
+		const FNodeIndexLookup& NodeIndexLookupRef = *NodeIndexLookup;
 
 		const int32 NumEdges = Edges->Num();
 		double Min = MAX_dbl;
@@ -746,7 +918,7 @@ namespace PCGExCluster
 
 	void FCluster::GetValidEdges(TArray<PCGExGraph::FIndexedEdge>& OutValidEdges) const
 	{
-		TMap<int32, int32>& LookupRef = (*NodeIndexLookup);
+		const FNodeIndexLookup& LookupRef = (*NodeIndexLookup);
 		for (const PCGExGraph::FIndexedEdge& Edge : (*Edges))
 		{
 			if (!Edge.bValid ||
@@ -881,6 +1053,16 @@ namespace PCGExCluster
 		for (int i = 0; i < VtxPointIndices->Num(); i++) { VtxPointIndicesRef[i] = NodesRef[i].PointIndex; }
 	}
 
+	void FCluster::CreateAdjacencyCSR()
+	{
+		FWriteScopeLock WriteScopeLock(ClusterLock);
+		if (AdjacencyCSR) { return; }
+
+		const TSharedPtr<FAdjacencyCSR> NewCSR = MakeShared<FAdjacencyCSR>();
+		NewCSR->Build(*Nodes);
+		AdjacencyCSR = NewCSR;
+	}
+
 	void FCluster::CreateVtxPointScopes()
 	{
 		if (!VtxPointIndices) { CreateVtxPointIndices(); }
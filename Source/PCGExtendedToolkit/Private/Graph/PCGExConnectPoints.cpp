@@ -3,6 +3,7 @@
 
 #include "Graph/PCGExConnectPoints.h"
 
+#include "Algo/Unique.h"
 
 #include "Graph/PCGExGraph.h"
 #include "Graph/Data/PCGExClusterData.h"
@@ -306,14 +307,26 @@ namespace PCGExConnectPoints
 
 	void FProcessor::CompleteWork()
 	{
+		// Loop sets overlap; merge them into a sorted, deduped array so the graph can skip its own deduplication.
+		// Sorting rather than inserting concurrently keeps edge order independent of scheduling.
+		int32 NumEdges = 0;
+		for (const TSharedPtr<TSet<uint64>>& EdgesSet : DistributedEdgesSet) { NumEdges += EdgesSet->Num(); }
+
+		TArray<uint64> UniqueEdges;
+		UniqueEdges.Reserve(NumEdges);
+
 		for (TSharedPtr<TSet<uint64>>& EdgesSet : DistributedEdgesSet)
 		{
-			GraphBuilder->Graph->InsertEdgesUnsafe(*EdgesSet, -1);
+			for (const uint64 E : *EdgesSet) { UniqueEdges.Add(E); }
 			EdgesSet.Reset();
 		}
 
 		DistributedEdgesSet.Empty();
 
+		UniqueEdges.Sort();
+		UniqueEdges.SetNum(Algo::Unique(UniqueEdges), EAllowShrinking::No);
+		GraphBuilder->Graph->AppendUniqueEdges(UniqueEdges, -1);
+
 		GraphBuilder->CompileAsync(AsyncManager, false);
 	}
 
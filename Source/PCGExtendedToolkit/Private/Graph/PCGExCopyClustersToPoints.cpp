@@ -94,27 +94,36 @@ namespace PCGExCopyClusters
 	void FProcessor::CompleteWork()
 	{
 		// Once work is complete, check if there are cached clusters we can forward
-		const TSharedPtr<PCGExCluster::FCluster> CachedCluster = PCGExClusterData::TryGetCachedCluster(VtxDataFacade->Source, EdgeDataFacade->Source);
+		TSharedPtr<PCGExCluster::FCluster> CachedCluster = PCGExClusterData::TryGetCachedCluster(VtxDataFacade->Source, EdgeDataFacade->Source);
+
+		if (!CachedCluster)
+		{
+			if (const TSharedPtr<PCGExClusterCache::FCache> PersistentCache = PCGExClusterCache::GetCache(ExecutionContext))
+			{
+				if (const uint64 Key = PCGExClusterCache::ComputeKey(VtxDataFacade->Source, EdgeDataFacade->Source, bIsOneToOne)) { CachedCluster = PersistentCache->Find(Key); }
+			}
+		}
 
 		if (!CachedCluster) { return; }
 
 		const TArray<FPCGPoint>& Targets = Context->Targets->GetIn()->GetPoints();
 		const int32 NumTargets = Targets.Num();
 
-		for (int i = 0; i < NumTargets; i++)
-		{
-			TSharedPtr<PCGExData::FPointIO> VtxDupe = *(VtxDupes->GetData() + i);
-			TSharedPtr<PCGExData::FPointIO> EdgeDupe = EdgesDupes[i];
-
-			UPCGExClusterEdgesData* EdgeDupeTypedData = Cast<UPCGExClusterEdgesData>(EdgeDupe->GetOut());
-			if (CachedCluster && EdgeDupeTypedData)
+		// Copies only differ by their transform : each gets a clone that shares the source topology and only owns its moved positions
+		ParallelFor(
+			NumTargets, [&](const int32 i)
 			{
+				const TSharedPtr<PCGExData::FPointIO> VtxDupe = *(VtxDupes->GetData() + i);
+				const TSharedPtr<PCGExData::FPointIO> EdgeDupe = EdgesDupes[i];
+
+				UPCGExClusterEdgesData* EdgeDupeTypedData = Cast<UPCGExClusterEdgesData>(EdgeDupe->GetOut());
+				if (!EdgeDupeTypedData) { return; }
+
 				EdgeDupeTypedData->SetBoundCluster(
 					MakeShared<PCGExCluster::FCluster>(
 						CachedCluster.ToSharedRef(), VtxDupe, EdgeDupe,
-						false, false, false));
-			}
-		}
+						Targets[i].Transform));
+			});
 	}
 
 	FBatch::~FBatch()
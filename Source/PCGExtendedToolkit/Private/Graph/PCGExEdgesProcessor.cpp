@@ -102,16 +102,44 @@ bool FPCGExEdgesProcessorContext::AdvanceEdges(const bool bBuildCluster, const b
 				false, false, false);
 		}
 
+		const bool bIsOneToOne = (TaggedEdges->Entries.Num() == 1);
+		uint64 PersistentKey = 0;
+		TSharedPtr<PCGExClusterCache::FCache> PersistentCache;
+
+		if (!CurrentCluster)
+		{
+			PersistentCache = PCGExClusterCache::GetCache(this);
+			if (PersistentCache)
+			{
+				PersistentKey = PCGExClusterCache::ComputeKey(CurrentIO.ToSharedRef(), CurrentEdges.ToSharedRef(), bIsOneToOne);
+				if (!PersistentKey) { PersistentCache.Reset(); }
+				else if (const TSharedPtr<PCGExCluster::FCluster> PersistentCluster = PersistentCache->Find(PersistentKey))
+				{
+					CurrentCluster = MakeShared<PCGExCluster::FCluster>(
+						PersistentCluster.ToSharedRef(), CurrentIO, CurrentEdges,
+						false, false, false);
+					CurrentCluster->bIsOneToOne = bIsOneToOne;
+				}
+			}
+		}
+
 		if (!CurrentCluster)
 		{
 			CurrentCluster = MakeShared<PCGExCluster::FCluster>(CurrentIO, CurrentEdges);
-			CurrentCluster->bIsOneToOne = (TaggedEdges->Entries.Num() == 1);
+			CurrentCluster->bIsOneToOne = bIsOneToOne;
 
 			if (!CurrentCluster->BuildFrom(EndpointsLookup, &EndpointsAdjacency))
 			{
 				PCGE_LOG_C(Warning, GraphAndLog, this, FTEXT("Some clusters are corrupted and will not be processed.  If you modified vtx/edges manually, make sure to use Sanitize Clusters first."));
 				CurrentCluster.Reset();
 			}
+			else if (PersistentCache)
+			{
+				PersistentCache->Add(PersistentKey, CurrentCluster.ToSharedRef());
+				CurrentCluster = MakeShared<PCGExCluster::FCluster>(
+					CurrentCluster.ToSharedRef(), CurrentIO, CurrentEdges,
+					false, false, false);
+			}
 		}
 
 		return true;
@@ -5,6 +5,7 @@
 
 #include "PCGExPointsProcessor.h"
 #include "PCGExRandom.h"
+#include "Async/ParallelFor.h"
 
 
 #include "Graph/PCGExCluster.h"
@@ -55,110 +56,204 @@ namespace PCGExGraph
 	void FGraph::ReserveForEdges(const int32 UpcomingAdditionCount)
 	{
 		const int32 NewMax = Edges.Num() + UpcomingAdditionCount;
-		UniqueEdges.Reserve(NewMax);
+		EdgeRegistry.Reserve(NewMax);
 		Edges.Reserve(NewMax);
 		EdgeMetadata.Reserve(UpcomingAdditionCount);
 	}
 
-	bool FGraph::InsertEdgeUnsafe(const int32 A, const int32 B, FIndexedEdge& OutEdge, const int32 IOIndex)
+	void FGraph::FlushEdgeRegistry()
 	{
-		bool bAlreadyExists;
-		const uint64 Hash = PCGEx::H64U(A, B);
+		if (!bHasUnregisteredEdges) { return; }
+
+		FWriteScopeLock WriteLock(GraphLock);
+		if (UnregisteredEdgesStart == -1) { return; }
 
-		UniqueEdges.Add(Hash, &bAlreadyExists);
+		// Edges that went through a deduplicating insert in the meantime are already registered, Add leaves them be
+		for (int i = UnregisteredEdgesStart; i < Edges.Num(); i++) { EdgeRegistry.Add(Edges[i].H64U(), i); }
 
-		if (bAlreadyExists) { return false; }
+		UnregisteredEdgesStart = -1;
+		bHasUnregisteredEdges = false;
+	}
 
-		OutEdge = Edges.Emplace_GetRef(Edges.Num(), A, B, -1, IOIndex);
+	void FGraph::FlushEdgeRegistryUnsafe()
+	{
+		if (UnregisteredEdgesStart == -1) { return; }
 
-		Nodes[A].Add(OutEdge.EdgeIndex);
-		Nodes[B].Add(OutEdge.EdgeIndex);
+		for (int i = UnregisteredEdgesStart; i < Edges.Num(); i++) { EdgeRegistry.AddUnsafe(Edges[i].H64U(), i); }
 
-		return true;
+		UnregisteredEdgesStart = -1;
+		bHasUnregisteredEdges = false;
 	}
 
-	bool FGraph::InsertEdge(const int32 A, const int32 B, FIndexedEdge& OutEdge, const int32 IOIndex)
+	int32 FGraph::AppendEdgeUnsafe(const int32 A, const int32 B, const int32 IOIndex)
 	{
-		FWriteScopeLock WriteLock(GraphLock);
-		return InsertEdgeUnsafe(A, B, OutEdge, IOIndex);
+		const int32 EdgeIndex = Edges.Emplace(Edges.Num(), A, B, -1, IOIndex);
+
+		Nodes[A].Add(EdgeIndex);
+		Nodes[B].Add(EdgeIndex);
+
+		return EdgeIndex;
 	}
 
-	bool FGraph::InsertEdgeUnsafe(const FIndexedEdge& Edge)
+	int32 FGraph::AppendEdgeUnsafe(const FIndexedEdge& Edge)
 	{
-		bool bAlreadyExists;
-		const uint64 Hash = Edge.H64U();
+		const int32 EdgeIndex = Edges.Num();
+		Edges.Emplace_GetRef(Edge).EdgeIndex = EdgeIndex;
 
-		UniqueEdges.Add(Hash, &bAlreadyExists);
+		Nodes[Edge.Start].Add(EdgeIndex);
+		Nodes[Edge.End].Add(EdgeIndex);
 
-		if (bAlreadyExists) { return false; }
+		return EdgeIndex;
+	}
 
-		UniqueEdges.Add(Hash);
+	int32 FGraph::InsertEdgeUnsafe(const int32 A, const int32 B, FIndexedEdge& OutEdge, const int32 IOIndex)
+	{
+		FlushEdgeRegistryUnsafe();
 
-		FIndexedEdge& NewEdge = Edges.Emplace_GetRef(Edge);
-		NewEdge.EdgeIndex = Edges.Num() - 1;
+		const uint64 Hash = PCGEx::H64U(A, B);
+		const int32 EdgeIndex = EdgeRegistry.AddUnsafe(Hash, Edges.Num()) ? AppendEdgeUnsafe(A, B, IOIndex) : EdgeRegistry.Find(Hash);
 
-		Nodes[Edge.Start].Add(NewEdge.EdgeIndex);
-		Nodes[Edge.End].Add(NewEdge.EdgeIndex);
+		OutEdge = Edges[EdgeIndex];
+		return EdgeIndex;
+	}
 
-		return true;
+	int32 FGraph::InsertEdge(const int32 A, const int32 B, FIndexedEdge& OutEdge, const int32 IOIndex)
+	{
+		FlushEdgeRegistry();
+
+		const uint64 Hash = PCGEx::H64U(A, B);
+		if (!EdgeRegistry.Claim(Hash))
+		{
+			// Duplicates never take the graph write lock
+			const int32 EdgeIndex = EdgeRegistry.Resolve(Hash);
+			FReadScopeLock ReadLock(GraphLock);
+			OutEdge = Edges[EdgeIndex];
+			return EdgeIndex;
+		}
+
+		{
+			FWriteScopeLock WriteLock(GraphLock);
+			OutEdge = Edges[AppendEdgeUnsafe(A, B, IOIndex)];
+		}
+
+		EdgeRegistry.Set(Hash, OutEdge.EdgeIndex);
+		return OutEdge.EdgeIndex;
 	}
 
-	bool FGraph::InsertEdge(const FIndexedEdge& Edge)
+	int32 FGraph::InsertEdgeUnsafe(const FIndexedEdge& Edge)
 	{
-		FWriteScopeLock WriteLock(GraphLock);
-		return InsertEdgeUnsafe(Edge);
+		FlushEdgeRegistryUnsafe();
+
+		const uint64 Hash = Edge.H64U();
+		return EdgeRegistry.AddUnsafe(Hash, Edges.Num()) ? AppendEdgeUnsafe(Edge) : EdgeRegistry.Find(Hash);
 	}
 
-	void FGraph::InsertEdges(const TArray<uint64>& InEdges, const int32 InIOIndex)
+	int32 FGraph::InsertEdge(const FIndexedEdge& Edge)
 	{
-		FWriteScopeLock WriteLock(GraphLock);
-		uint32 A;
-		uint32 B;
-		bool bAlreadyExists;
+		FlushEdgeRegistry();
+
+		const uint64 Hash = Edge.H64U();
+		if (!EdgeRegistry.Claim(Hash)) { return EdgeRegistry.Resolve(Hash); }
+
+		int32 EdgeIndex;
 
-		for (const uint64& E : InEdges)
 		{
-			UniqueEdges.Add(E, &bAlreadyExists);
-			if (bAlreadyExists) { continue; }
-
-			PCGEx::H64(E, A, B);
-			const int32 EdgeIndex = Edges.Emplace(Edges.Num(), A, B);
-			Nodes[A].Add(EdgeIndex);
-			Nodes[B].Add(EdgeIndex);
-			Edges[EdgeIndex].IOIndex = InIOIndex;
+			FWriteScopeLock WriteLock(GraphLock);
+			EdgeIndex = AppendEdgeUnsafe(Edge);
 		}
+
+		EdgeRegistry.Set(Hash, EdgeIndex);
+		return EdgeIndex;
+	}
+
+	template <typename T>
+	void FGraph::InsertHashedEdges(const T& InEdges, const int32 InIOIndex)
+	{
+		FlushEdgeRegistry();
+
+		// Claim first, so only new edges are appended under the graph lock
+		TArray<uint64> NewEdges;
+		NewEdges.Reserve(InEdges.Num());
+		for (const uint64 E : InEdges) { if (EdgeRegistry.Claim(E)) { NewEdges.Add(E); } }
+
+		if (NewEdges.IsEmpty()) { return; }
+
+		int32 StartIndex;
+
+		{
+			FWriteScopeLock WriteLock(GraphLock);
+			StartIndex = Edges.Num();
+			for (const uint64 E : NewEdges) { AppendEdgeUnsafe(PCGEx::H64A(E), PCGEx::H64B(E), InIOIndex); }
+		}
+
+		for (int i = 0; i < NewEdges.Num(); i++) { EdgeRegistry.Set(NewEdges[i], StartIndex + i); }
+	}
+
+	void FGraph::InsertEdges(const TArray<uint64>& InEdges, const int32 InIOIndex)
+	{
+		InsertHashedEdges(InEdges, InIOIndex);
 	}
 
 	int32 FGraph::InsertEdges(const TArray<FIndexedEdge>& InEdges)
 	{
-		FWriteScopeLock WriteLock(GraphLock);
-		const int32 StartIndex = Edges.Num();
-		for (const FIndexedEdge& E : InEdges) { InsertEdgeUnsafe(E); }
+		FlushEdgeRegistry();
+
+		TArray<const FIndexedEdge*> NewEdges;
+		NewEdges.Reserve(InEdges.Num());
+		for (const FIndexedEdge& E : InEdges) { if (EdgeRegistry.Claim(E.H64U())) { NewEdges.Add(&E); } }
+
+		int32 StartIndex;
+
+		{
+			FWriteScopeLock WriteLock(GraphLock);
+			StartIndex = Edges.Num();
+			for (const FIndexedEdge* E : NewEdges) { AppendEdgeUnsafe(*E); }
+		}
+
+		for (int i = 0; i < NewEdges.Num(); i++) { EdgeRegistry.Set(NewEdges[i]->H64U(), StartIndex + i); }
+
 		return StartIndex;
 	}
 
 	void FGraph::InsertEdgesUnsafe(const TSet<uint64>& InEdges, const int32 InIOIndex)
 	{
-		uint32 A;
-		uint32 B;
-		bool bAlreadyExists;
-		for (const uint64& E : InEdges)
+		FlushEdgeRegistryUnsafe();
+
+		for (const uint64 E : InEdges)
 		{
-			UniqueEdges.Add(E, &bAlreadyExists);
-			if (bAlreadyExists) { continue; }
-
-			PCGEx::H64(E, A, B);
-			const int32 EdgeIndex = Edges.Emplace(Edges.Num(), A, B);
-			Nodes[A].Add(EdgeIndex);
-			Nodes[B].Add(EdgeIndex);
-			Edges[EdgeIndex].IOIndex = InIOIndex;
+			if (!EdgeRegistry.AddUnsafe(E, Edges.Num())) { continue; }
+			AppendEdgeUnsafe(PCGEx::H64A(E), PCGEx::H64B(E), InIOIndex);
 		}
 	}
 
 	void FGraph::InsertEdges(const TSet<uint64>& InEdges, const int32 InIOIndex)
+	{
+		InsertHashedEdges(InEdges, InIOIndex);
+	}
+
+	void FGraph::AppendUniqueEdges(const TArray<uint64>& InEdges, const int32 InIOIndex)
 	{
 		FWriteScopeLock WriteLock(GraphLock);
-		InsertEdgesUnsafe(InEdges, InIOIndex);
+
+		if (UnregisteredEdgesStart == -1) { UnregisteredEdgesStart = Edges.Num(); }
+		bHasUnregisteredEdges = true;
+
+		Edges.Reserve(Edges.Num() + InEdges.Num());
+		for (const uint64 E : InEdges) { AppendEdgeUnsafe(PCGEx::H64A(E), PCGEx::H64B(E), InIOIndex); }
+	}
+
+	int32 FGraph::AppendUniqueEdges(const TArray<FIndexedEdge>& InEdges)
+	{
+		FWriteScopeLock WriteLock(GraphLock);
+
+		const int32 StartIndex = Edges.Num();
+		if (UnregisteredEdgesStart == -1) { UnregisteredEdgesStart = StartIndex; }
+		bHasUnregisteredEdges = true;
+
+		Edges.Reserve(StartIndex + InEdges.Num());
+		for (const FIndexedEdge& E : InEdges) { AppendEdgeUnsafe(E); }
+
+		return StartIndex;
 	}
 
 	TArrayView<FNode> FGraph::AddNodes(const int32 NumNewNodes)
@@ -180,68 +275,183 @@ namespace PCGExGraph
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FGraph::BuildSubGraphs);
 
-		TBitArray<> VisitedNodes;
-		TBitArray<> VisitedEdges;
-		VisitedNodes.Init(false, Nodes.Num());
-		VisitedEdges.Init(false, Edges.Num());
+		const int32 NumNodes = Nodes.Num();
+		const int32 NumEdges = Edges.Num();
 
-		int32 VisitedNum = 0;
+		// Lock-free union-find over valid edges.
+		// Roots are always linked under the smaller index, so each component ends up rooted at its lowest node.
 
-		for (int i = 0; i < Nodes.Num(); i++)
+		TUniquePtr<std::atomic<int32>[]> Parent = MakeUnique<std::atomic<int32>[]>(NumNodes);
+		for (int i = 0; i < NumNodes; i++) { Parent[i].store(i, std::memory_order_relaxed); }
+
+		auto FindRoot = [&](int32 Index)
 		{
-			const FNode& CurrentNode = Nodes[i];
+			while (true)
+			{
+				const int32 P = Parent[Index].load(std::memory_order_relaxed);
+				if (P == Index) { return Index; }
 
-			if (VisitedNodes[i]) { continue; }
+				const int32 GP = Parent[P].load(std::memory_order_relaxed);
+				if (GP != P)
+				{
+					int32 Expected = P;
+					Parent[Index].compare_exchange_weak(Expected, GP, std::memory_order_relaxed); // Path halving
+				}
 
-			VisitedNodes[i] = true;
-			VisitedNum++;
+				Index = GP;
+			}
+		};
 
-			if (!CurrentNode.bValid || CurrentNode.Adjacency.IsEmpty()) { continue; }
+		auto IsValidEdge = [&](const FIndexedEdge& Edge) { return Edge.bValid && Nodes[Edge.Start].bValid && Nodes[Edge.End].bValid; };
 
-			TSharedPtr<FSubGraph> SubGraph = MakeShared<FSubGraph>();
-			SubGraph->ParentGraph = this;
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(FGraph::BuildSubGraphs::Label);
 
-			TArray<int32> Stack;
-			Stack.Reserve(Nodes.Num() - VisitedNum);
-			Stack.Add(i);
+			ParallelFor(
+				NumEdges, [&](const int32 EdgeIndex)
+				{
+					const FIndexedEdge& Edge = Edges[EdgeIndex];
+					if (!IsValidEdge(Edge)) { return; }
+
+					int32 A = Edge.Start;
+					int32 B = Edge.End;
+
+					while (true)
+					{
+						A = FindRoot(A);
+						B = FindRoot(B);
+
+						if (A == B) { return; }
+						if (A < B) { Swap(A, B); }
+
+						int32 Expected = A;
+						if (Parent[A].compare_exchange_strong(Expected, B)) { return; }
+					}
+				});
+		}
 
-			while (Stack.Num() > 0)
+		// Per-node root, then per-edge root
+
+		TArray<int32> NodeRoot;
+		TArray<int32> EdgeRoot;
+		PCGEx::InitArray(NodeRoot, NumNodes);
+		PCGEx::InitArray(EdgeRoot, NumEdges);
+
+		ParallelFor(
+			NumNodes, [&](const int32 NodeIndex)
 			{
-#if PCGEX_ENGINE_VERSION <= 503
-				const int32 NextIndex = Stack.Pop(false);
-#else
-				const int32 NextIndex = Stack.Pop(EAllowShrinking::No);
-#endif
-				FNode& Node = Nodes[NextIndex];
-				Node.NumExportedEdges = 0;
+				FNode& Node = Nodes[NodeIndex];
+				NodeRoot[NodeIndex] = -1;
+
+				if (!Node.bValid) { return; }
 
 				for (const int32 E : Node.Adjacency)
 				{
-					if (VisitedEdges[E]) { continue; }
+					if (!IsValidEdge(Edges[E])) { continue; }
+					NodeRoot[NodeIndex] = FindRoot(NodeIndex);
+					return;
+				}
+			});
 
-					VisitedEdges[E] = true;
+		ParallelFor(
+			NumEdges, [&](const int32 EdgeIndex)
+			{
+				const FIndexedEdge& Edge = Edges[EdgeIndex];
+				EdgeRoot[EdgeIndex] = IsValidEdge(Edge) ? NodeRoot[Edge.Start] : -1;
+			});
 
-					const FIndexedEdge& Edge = Edges[E];
+		// Bucket nodes & edges per component. Scattering in index order keeps every list sorted.
 
-					if (!Edge.bValid) { continue; }
+		TArray<int32> ComponentIndex;
+		PCGEx::InitArray(ComponentIndex, NumNodes);
 
-					const int32 OtherIndex = Edge.Other(NextIndex);
-					if (!Nodes[OtherIndex].bValid) { continue; }
+		TArray<TSharedPtr<FSubGraph>> Components;
+		for (int i = 0; i < NumNodes; i++)
+		{
+			ComponentIndex[i] = -1;
+			if (NodeRoot[i] != i) { continue; }
 
-					Node.NumExportedEdges++;
-					SubGraph->Add(Edge, this);
+			ComponentIndex[i] = Components.Num();
+			TSharedPtr<FSubGraph> SubGraph = MakeShared<FSubGraph>();
+			SubGraph->ParentGraph = this;
+			Components.Add(SubGraph);
+		}
 
-					if (!VisitedNodes[OtherIndex]) // Only enqueue if not already visited
-					{
-						VisitedNodes[OtherIndex] = true;
-						VisitedNum++;
+		const int32 NumComponents = Components.Num();
+		if (NumComponents == 0) { return; }
 
-						Stack.Add(OtherIndex);
-					}
-				}
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(FGraph::BuildSubGraphs::Bucket);
+
+			TArray<int32> NodeCounts;
+			TArray<int32> EdgeCounts;
+			NodeCounts.Init(0, NumComponents);
+			EdgeCounts.Init(0, NumComponents);
+
+			for (int i = 0; i < NumNodes; i++) { if (NodeRoot[i] != -1) { NodeCounts[ComponentIndex[NodeRoot[i]]]++; } }
+			for (int i = 0; i < NumEdges; i++) { if (EdgeRoot[i] != -1) { EdgeCounts[ComponentIndex[EdgeRoot[i]]]++; } }
+
+			for (int i = 0; i < NumComponents; i++)
+			{
+				Components[i]->Nodes.Reserve(NodeCounts[i]);
+				Components[i]->Edges.Reserve(EdgeCounts[i]);
 			}
 
+			for (int i = 0; i < NumNodes; i++) { if (NodeRoot[i] != -1) { Components[ComponentIndex[NodeRoot[i]]]->Nodes.Add(i); } }
+			for (int i = 0; i < NumEdges; i++) { if (EdgeRoot[i] != -1) { Components[ComponentIndex[EdgeRoot[i]]]->Edges.Add(i); } }
+
+			// Each component owns its nodes & valid edges, so they can be flagged from separate threads
+			TArray<bool> VisitedNodes;
+			TArray<bool> VisitedEdges;
+			VisitedNodes.Init(false, NumNodes);
+			VisitedEdges.Init(false, NumEdges);
+
+			ParallelFor(
+				NumComponents, [&](const int32 Index)
+				{
+					const TSharedPtr<FSubGraph>& SubGraph = Components[Index];
+					for (const int32 E : SubGraph->Edges) { if (const int32 IOIndex = Edges[E].IOIndex; IOIndex >= 0) { SubGraph->EdgesInIOIndices.Add(IOIndex); } }
 
+					// Replay the depth-first walk from the lowest node so NumExportedEdges keeps counting
+					// only the edges first reached from each node, as it is written to the vtx endpoint attribute
+
+					TArray<int32> Stack;
+					Stack.Reserve(SubGraph->Nodes.Num());
+					Stack.Add(SubGraph->Nodes[0]);
+					VisitedNodes[SubGraph->Nodes[0]] = true;
+
+					while (Stack.Num() > 0)
+					{
+#if PCGEX_ENGINE_VERSION <= 503
+						const int32 NextIndex = Stack.Pop(false);
+#else
+						const int32 NextIndex = Stack.Pop(EAllowShrinking::No);
+#endif
+						FNode& Node = Nodes[NextIndex];
+						Node.NumExportedEdges = 0;
+
+						for (const int32 E : Node.Adjacency)
+						{
+							const FIndexedEdge& Edge = Edges[E];
+							if (VisitedEdges[E] || !IsValidEdge(Edge)) { continue; }
+
+							VisitedEdges[E] = true;
+							Node.NumExportedEdges++;
+
+							const int32 OtherIndex = Edge.Other(NextIndex);
+							if (!VisitedNodes[OtherIndex])
+							{
+								VisitedNodes[OtherIndex] = true;
+								Stack.Add(OtherIndex);
+							}
+						}
+					}
+				});
+		}
+
+		SubGraphs.Reserve(SubGraphs.Num() + NumComponents);
+		for (const TSharedPtr<FSubGraph>& SubGraph : Components)
+		{
 			if (!Limits.IsValid(SubGraph)) { SubGraph->Invalidate(this); } // Will invalidate isolated points
 			else { SubGraphs.Add(SubGraph); }
 		}
@@ -450,7 +660,7 @@ namespace PCGExGraphTask
 		const TArray<FPCGPoint>& Vertices = VtxDataFacade->GetOut()->GetPoints();
 
 		PCGExGraph::FGraph* Graph = SubGraph->ParentGraph;
-		TArray<int32> EdgeDump = SubGraph->Edges.Array();
+		const TArray<int32>& EdgeDump = SubGraph->Edges;
 		const int32 NumEdges = EdgeDump.Num();
 
 		TArray<int32> RootEdgeIndices;
@@ -602,9 +812,19 @@ MACRO(EdgeUnionSize, int32, 0, UnionSize)
 			PCGExGraph::MarkClusterEdges(EdgeDupe, OutId);
 
 			InternalStart<PCGExGeoTasks::FTransformPointIO>(TaskIndex, PointIO, EdgeDupe, TransformDetails);
-		}
 
-		// TODO : Copy & Transform cluster as well for a big perf boost
+			// The duplicate inherits the source binding, which doesn't account for the transform
+			UPCGExClusterEdgesData* EdgeDupeTypedData = Cast<UPCGExClusterEdgesData>(EdgeDupe->GetOut());
+			if (!EdgeDupeTypedData) { continue; }
+
+			if (const TSharedPtr<PCGExCluster::FCluster> SourceCluster = EdgeDupeTypedData->GetBoundCluster())
+			{
+				EdgeDupeTypedData->SetBoundCluster(
+					MakeShared<PCGExCluster::FCluster>(
+						SourceCluster.ToSharedRef(), VtxDupe, EdgeDupe,
+						PointIO->GetInPoint(TaskIndex).Transform));
+			}
+		}
 
 		return true;
 	}
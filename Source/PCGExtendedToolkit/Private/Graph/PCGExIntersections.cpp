@@ -25,6 +25,23 @@ namespace PCGExGraph
 		return Center;
 	}
 
+	FUnionNode* FUnionGraph::NewNode(const FPCGPoint& Point, const FVector& Origin, const int32 IOIndex, const int32 PointIndex)
+	{
+		const int32 NodeIndex = Nodes.Num();
+		const int32 PageIndex = NodeIndex / NodesPerPage;
+
+		if (PageIndex == NodePages.Num())
+		{
+			NodePages.Add(static_cast<FUnionNode*>(FMemory::Malloc(NodesPerPage * sizeof(FUnionNode), alignof(FUnionNode))));
+		}
+
+		FUnionNode* Node = new(NodePages[PageIndex] + NodeIndex % NodesPerPage) FUnionNode(Point, Origin, NodeIndex);
+		Nodes.Add(Node);
+		PointsUnion->NewEntry(IOIndex, PointIndex);
+
+		return Node;
+	}
+
 	FUnionNode* FUnionGraph::InsertPoint(const FPCGPoint& Point, const int32 IOIndex, const int32 PointIndex)
 	{
 		const FVector Origin = Point.Transform.GetLocation();
@@ -32,37 +49,38 @@ namespace PCGExGraph
 
 		if (!Octree)
 		{
-			const uint32 GridKey = FuseDetails.GetGridKey(Origin);
-			FUnionNode** NodePtr;
-			{
-				FReadScopeLock ReadScopeLock(UnionLock);
-				NodePtr = GridTree.Find(GridKey);
-			}
+			const FInt64Vector3 GridCell = FuseDetails.GetGridCell(Origin);
+			FGridShard& Shard = GetGridShard(GridCell);
+			FGridCell Cell;
 
-			if (NodePtr)
 			{
-				Node = *NodePtr;
-				PointsUnion->Append(Node->Index, IOIndex, PointIndex);
-				return Node;
+				FReadScopeLock ReadScopeLock(Shard.Lock);
+				if (const FGridCell* ExistingCell = Shard.Cells.Find(GridCell)) { Cell = *ExistingCell; }
 			}
 
+			if (!Cell.Node)
 			{
-				FWriteScopeLock WriteLock(UnionLock);
-				NodePtr = GridTree.Find(GridKey); // Make sure there hasn't been an insert while locking
+				FWriteScopeLock WriteLock(Shard.Lock);
 
-				if (NodePtr)
+				// Make sure there hasn't been an insert while locking
+				if (const FGridCell* ExistingCell = Shard.Cells.Find(GridCell)) { Cell = *ExistingCell; }
+				else
 				{
-					Node = *NodePtr;
-					PointsUnion->Append(Node->Index, IOIndex, PointIndex);
-					return Node;
-				}
+					{
+						// Only node creation is serialized across shards
+						FWriteScopeLock WriteNodesLock(UnionLock);
+						Cell.Node = NewNode(Point, Origin, IOIndex, PointIndex);
+						Cell.Union = PointsUnion->Get(Cell.Node->Index);
+					}
 
-				Node = Nodes.Add_GetRef(new FUnionNode(Point, Origin, Nodes.Num()));
-				PointsUnion->NewEntry(IOIndex, PointIndex);
-				GridTree.Add(GridKey, Node);
+					Shard.Cells.Add(GridCell, Cell);
+					return Cell.Node;
+				}
 			}
 
-			return Node;
+			// Cells cache their union entry, so appending doesn't touch the shared (and growing) entries array
+			Cell.Union->Add(IOIndex, PointIndex);
+			return Cell.Node;
 		}
 
 		{
@@ -111,9 +129,8 @@ namespace PCGExGraph
 			// Write lock start
 			FWriteScopeLock WriteScopeLock(UnionLock);
 
-			Node = Nodes.Add_GetRef(new FUnionNode(Point, Origin, Nodes.Num()));
+			Node = NewNode(Point, Origin, IOIndex, PointIndex);
 			Octree->AddElement(Node);
-			PointsUnion->NewEntry(IOIndex, PointIndex);
 		}
 
 		return Node;
@@ -128,20 +145,20 @@ namespace PCGExGraph
 
 		if (!Octree)
 		{
-			const uint32 GridKey = FuseDetails.GetGridKey(Origin);
+			const FInt64Vector3 GridCell = FuseDetails.GetGridCell(Origin);
+			FGridShard& Shard = GetGridShard(GridCell);
 
-			if (FUnionNode** NodePtr = GridTree.Find(GridKey))
+			if (const FGridCell* ExistingCell = Shard.Cells.Find(GridCell))
 			{
-				Node = *NodePtr;
-				PointsUnion->Append(Node->Index, IOIndex, PointIndex);
-				return Node;
+				ExistingCell->Union->Add(IOIndex, PointIndex);
+				return ExistingCell->Node;
 			}
 
-			Node = Nodes.Add_GetRef(new FUnionNode(Point, Origin, Nodes.Num()));
-			PointsUnion->NewEntry(IOIndex, PointIndex);
-			GridTree.Add(GridKey, Node);
+			FGridCell& Cell = Shard.Cells.Add(GridCell);
+			Cell.Node = NewNode(Point, Origin, IOIndex, PointIndex);
+			Cell.Union = PointsUnion->Get(Cell.Node->Index);
 
-			return Node;
+			return Cell.Node;
 		}
 
 		int32 NodeIndex = -1;
@@ -179,9 +196,8 @@ namespace PCGExGraph
 			return Nodes[NodeIndex];
 		}
 
-		Node = Nodes.Add_GetRef(new FUnionNode(Point, Origin, Nodes.Num()));
+		Node = NewNode(Point, Origin, IOIndex, PointIndex);
 		Octree->AddElement(Node);
-		PointsUnion->NewEntry(IOIndex, PointIndex);
 
 		return Node;
 	}
@@ -374,13 +390,13 @@ namespace PCGExGraph
 			{
 				NodeIndex = Split.NodeIndex;
 
-				Graph->InsertEdge(PrevIndex, NodeIndex, NewEdge, SplitEdge.IOIndex); //TODO: IOIndex required
+				const int32 NewEdgeIndex = Graph->InsertEdge(PrevIndex, NodeIndex, NewEdge, SplitEdge.IOIndex); //TODO: IOIndex required
 				PrevIndex = NodeIndex;
 
 				FGraphNodeMetadata& NodeMetadata = FGraphNodeMetadata::GetOrCreate(NodeIndex, Graph->NodeMetadata);
 				NodeMetadata.Type = EPCGExIntersectionType::PointEdge;
 
-				FGraphEdgeMetadata& EdgeMetadata = FGraphEdgeMetadata::GetOrCreate(NewEdge.EdgeIndex, SplitEdgeMeta, Graph->EdgeMetadata);
+				FGraphEdgeMetadata& EdgeMetadata = FGraphEdgeMetadata::GetOrCreate(NewEdgeIndex, SplitEdgeMeta, Graph->EdgeMetadata);
 				EdgeMetadata.Type = EPCGExIntersectionType::PointEdge;
 
 				if (Details->bSnapOnEdge)
@@ -486,13 +502,13 @@ namespace PCGExGraph
 				const FEECrossing& Crossing = Crossings[IntersectionIndex];
 
 				NodeIndex = Crossing.NodeIndex;
-				Graph->InsertEdgeUnsafe(PrevIndex, NodeIndex, NewEdge, SplitEdge.IOIndex); //TODO: this is the wrong edge IOIndex
+				const int32 NewEdgeIndex = Graph->InsertEdgeUnsafe(PrevIndex, NodeIndex, NewEdge, SplitEdge.IOIndex); //TODO: this is the wrong edge IOIndex
 				PrevIndex = NodeIndex;
 
 				FGraphNodeMetadata& NodeMetadata = FGraphNodeMetadata::GetOrCreate(NodeIndex, Graph->NodeMetadata);
 				NodeMetadata.Type = EPCGExIntersectionType::EdgeEdge;
 
-				FGraphEdgeMetadata& EdgeMetadata = FGraphEdgeMetadata::GetOrCreate(NewEdge.EdgeIndex, SplitEdgeMeta, Graph->EdgeMetadata);
+				FGraphEdgeMetadata& EdgeMetadata = FGraphEdgeMetadata::GetOrCreate(NewEdgeIndex, SplitEdgeMeta, Graph->EdgeMetadata);
 				EdgeMetadata.Type = EPCGExIntersectionType::EdgeEdge;
 			}
 
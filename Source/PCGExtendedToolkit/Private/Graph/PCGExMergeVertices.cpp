@@ -122,10 +122,10 @@ namespace PCGExMergeVertices
 
 	void FProcessor::CompleteWork()
 	{
-		const TSharedPtr<TMap<int32, int32>> OffsetLookup = MakeShared<TMap<int32, int32>>();
+		const TSharedPtr<PCGExCluster::FNodeIndexLookup> OffsetLookup = MakeShared<PCGExCluster::FNodeIndexLookup>(
+			StartIndexOffset + Cluster->NumRawVtx, Cluster->NodeIndexLookup->Num());
 
-		OffsetLookup->Reserve(Cluster->NodeIndexLookup->Num());
-		for (const TPair<int32, int32>& Lookup : (*Cluster->NodeIndexLookup)) { OffsetLookup->Add(Lookup.Key + StartIndexOffset, Lookup.Value); }
+		Cluster->NodeIndexLookup->ForEach([&](const int32 PointIndex, const int32 NodeIndex) { OffsetLookup->Add(PointIndex + StartIndexOffset, NodeIndex); });
 
 		Cluster->NodeIndexLookup = OffsetLookup;
 
@@ -255,7 +255,10 @@ namespace PCGExMeshToCluster
 			NewVtx.Transform.SetLocation(Mesh->Vertices[i]);
 		}
 
-		GraphBuilder->Graph->InsertEdges(Mesh->Edges, -1);
+		// Mesh edges are unique by construction, no need to deduplicate them again
+		TArray<uint64> MeshEdges = Mesh->Edges.Array();
+		MeshEdges.Sort();
+		GraphBuilder->Graph->AppendUniqueEdges(MeshEdges, -1);
 		GraphBuilder->CompileAsync(Context->GetAsyncManager(), true);
 
 		return true;
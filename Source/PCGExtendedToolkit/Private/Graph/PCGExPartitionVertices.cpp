@@ -70,8 +70,6 @@ namespace PCGExPartitionVertices
 
 		if (!FClusterProcessor::Process(InAsyncManager)) { return false; }
 
-		Cluster->NodeIndexLookup->Empty();
-
 		PointPartitionIO = Context->VtxPartitions->Emplace_GetRef(VtxDataFacade->Source, PCGExData::EInit::NewOutput);
 		TArray<FPCGPoint>& MutablePoints = PointPartitionIO->GetOut()->GetMutablePoints();
 
@@ -82,7 +80,7 @@ namespace PCGExPartitionVertices
 		Cluster->WillModifyVtxIO();
 
 		Cluster->VtxIO = PointPartitionIO;
-		Cluster->NodeIndexLookup->Reserve(NumNodes);
+		Cluster->NodeIndexLookup = MakeShared<PCGExCluster::FNodeIndexLookup>(NumNodes, NumNodes);
 		Cluster->NumRawVtx = NumNodes;
 
 		for (PCGExCluster::FNode& Node : (*Cluster->Nodes))
@@ -131,7 +131,7 @@ namespace PCGExGraph
 		//GraphBuilder->Graph->InsertEdges(UniqueEdges, -1);
 		TArray<FIndexedEdge> UniqueEdges;
 		UnionGraph->GetUniqueEdges(UniqueEdges);
-		GraphBuilder->Graph->InsertEdges(UniqueEdges);
+		GraphBuilder->Graph->AppendUniqueEdges(UniqueEdges);
 
 		PCGEX_ASYNC_GROUP_CHKD_VOID(Context->GetAsyncManager(), WriteMetadataTask);
 		TWeakPtr<FUnionProcessor> WeakPtr = SharedThis(this);
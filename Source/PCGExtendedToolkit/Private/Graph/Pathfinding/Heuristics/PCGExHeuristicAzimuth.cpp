@@ -15,6 +15,8 @@ void UPCGExHeuristicAzimuth::PrepareForCluster(const PCGExCluster::FCluster* InC
 		OutMin = 0;
 		OutMax = 1;
 	}
+	bGlobalScoreUsesSeed = true;
+	bEdgeScoreUsesGoal = true;
 	Super::PrepareForCluster(InCluster);
 }
 
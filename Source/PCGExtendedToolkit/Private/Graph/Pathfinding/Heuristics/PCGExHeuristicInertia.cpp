@@ -15,6 +15,7 @@ void UPCGExHeuristicInertia::PrepareForCluster(const PCGExCluster::FCluster* InC
 		OutMin = 1;
 		OutMax = 0;
 	}
+	bEdgeScoreUsesTravel = true;
 	Super::PrepareForCluster(InCluster);
 }
 
@@ -0,0 +1,202 @@
+﻿// Copyright Timothé Lapetite 2024
+// Released under the MIT license https://opensource.org/license/MIT/
+
+
+#include "Graph/Pathfinding/Heuristics/PCGExHeuristicLandmarks.h"
+
+#include "Async/ParallelFor.h"
+#include "Hash/CityHash.h"
+#include "Graph/Data/PCGExClusterData.h"
+#include "Graph/Pathfinding/Heuristics/PCGExHeuristics.h"
+
+namespace PCGExHeuristics
+{
+	uint64 FLandmarks::HashCosts(const TArray<double>& InEdgeCosts)
+	{
+		return CityHash64(reinterpret_cast<const char*>(InEdgeCosts.GetData()), InEdgeCosts.Num() * sizeof(double));
+	}
+
+	bool FLandmarks::IsValidWith(const uint64 InVtxUID, const PCGExCluster::FCluster* InCluster, const int32 InNumLandmarks, const uint64 InCostHash) const
+	{
+		return VtxUID == InVtxUID &&
+			NumNodes == InCluster->Nodes->Num() &&
+			NumEdges == InCluster->Edges->Num() &&
+			NumLandmarks == FMath::Min(InNumLandmarks, NumNodes) &&
+			CostHash == InCostHash;
+	}
+
+	void FLandmarks::Build(const PCGExCluster::FCluster* InCluster, const int32 InNumLandmarks, const TArray<double>& InEdgeCosts)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExHeuristics::FLandmarks::Build);
+
+		NumNodes = InCluster->Nodes->Num();
+		NumEdges = InCluster->Edges->Num();
+		NumLandmarks = FMath::Min(InNumLandmarks, NumNodes);
+		CostHash = HashCosts(InEdgeCosts);
+
+		LandmarkNodes.Reset(NumLandmarks);
+		Distances.Init(-1, NumNodes * NumLandmarks);
+
+		if (NumLandmarks <= 0) { return; }
+
+		// Farthest-point sampling on positions : landmarks end up on the periphery, where bounds are tightest
+
+		TArray<double> ClosestLandmarkDist;
+		ClosestLandmarkDist.Init(MAX_dbl, NumNodes);
+
+		int32 NextLandmark = 0;
+		double BestDist = -1;
+		const FVector Center = InCluster->Bounds.GetCenter();
+		for (int i = 0; i < NumNodes; i++)
+		{
+			const double Dist = FVector::DistSquared(Center, InCluster->GetPos(i));
+			if (Dist > BestDist)
+			{
+				BestDist = Dist;
+				NextLandmark = i;
+			}
+		}
+
+		while (LandmarkNodes.Num() < NumLandmarks)
+		{
+			LandmarkNodes.Add(NextLandmark);
+			const FVector LandmarkPos = InCluster->GetPos(NextLandmark);
+
+			BestDist = -1;
+			for (int i = 0; i < NumNodes; i++)
+			{
+				const double Dist = FMath::Min(ClosestLandmarkDist[i], FVector::DistSquared(LandmarkPos, InCluster->GetPos(i)));
+				ClosestLandmarkDist[i] = Dist;
+				if (Dist > BestDist)
+				{
+					BestDist = Dist;
+					NextLandmark = i;
+				}
+			}
+		}
+
+		// One independent Dijkstra per landmark, each writing its own column
+
+		struct FHeapEntry
+		{
+			double Dist;
+			int32 NodeIndex;
+			bool operator<(const FHeapEntry& Other) const { return Dist < Other.Dist; }
+		};
+
+		ParallelFor(
+			NumLandmarks, [&](const int32 LandmarkIndex)
+			{
+				TArray<double> Dist;
+				Dist.Init(MAX_dbl, NumNodes);
+
+				TArray<FHeapEntry> Heap;
+				Heap.Reserve(NumNodes);
+
+				const int32 Root = LandmarkNodes[LandmarkIndex];
+				Dist[Root] = 0;
+				Heap.HeapPush(FHeapEntry{0, Root});
+
+				while (!Heap.IsEmpty())
+				{
+					FHeapEntry Current;
+					Heap.HeapPop(Current, EAllowShrinking::No);
+
+					if (Current.Dist > Dist[Current.NodeIndex]) { continue; } // Stale
+
+					for (const uint64 Link : InCluster->GetLinks(Current.NodeIndex))
+					{
+						const int32 NeighborIndex = PCGEx::H64A(Link);
+						const double Alt = Current.Dist + InEdgeCosts[PCGEx::H64B(Link)];
+						if (Alt >= Dist[NeighborIndex]) { continue; }
+
+						Dist[NeighborIndex] = Alt;
+						Heap.HeapPush(FHeapEntry{Alt, NeighborIndex});
+					}
+				}
+
+				for (int i = 0; i < NumNodes; i++)
+				{
+					if (Dist[i] != MAX_dbl) { Distances[i * NumLandmarks + LandmarkIndex] = Dist[i]; }
+				}
+			});
+	}
+}
+
+void UPCGExHeuristicLandmarks::CompleteClusterPreparation(const PCGExHeuristics::THeuristicsHandler* InHandler)
+{
+	Super::CompleteClusterPreparation(InHandler);
+
+	// Landmark costs must match what A* pays along edges, in either direction, for the bound to stay admissible
+
+	const TArray<PCGExGraph::FIndexedEdge>& EdgesRef = *Cluster->Edges;
+	const TArray<PCGExCluster::FNode>& NodesRef = *Cluster->Nodes;
+	const PCGExCluster::FNodeIndexLookup& NodeIndexLookup = *Cluster->NodeIndexLookup;
+
+	TArray<double> EdgeCosts;
+	EdgeCosts.SetNumUninitialized(EdgesRef.Num());
+	for (int i = 0; i < EdgesRef.Num(); i++)
+	{
+		const PCGExGraph::FIndexedEdge& Edge = EdgesRef[i];
+		const PCGExCluster::FNode& Start = NodesRef[NodeIndexLookup[Edge.Start]];
+		const PCGExCluster::FNode& End = NodesRef[NodeIndexLookup[Edge.End]];
+		EdgeCosts[i] = FMath::Max(0, FMath::Min(InHandler->GetStaticEdgeScore(Start, End, Edge), InHandler->GetStaticEdgeScore(End, Start, Edge)));
+	}
+
+	const uint64 VtxUID = PrimaryDataFacade ? PrimaryDataFacade->Source->GetIn()->UID : 0;
+
+	if (!SecondaryDataFacade)
+	{
+		BuildLandmarks(VtxUID, EdgeCosts);
+		return;
+	}
+
+	// Tables are read from the input and forwarded to the output, the same way the cached cluster is
+	if (const UPCGExClusterEdgesData* InEdgesData = Cast<UPCGExClusterEdgesData>(SecondaryDataFacade->Source->GetIn()))
+	{
+		Landmarks = InEdgesData->GetBoundLandmarks();
+		if (Landmarks && !Landmarks->IsValidWith(VtxUID, Cluster, NumLandmarks, PCGExHeuristics::FLandmarks::HashCosts(EdgeCosts))) { Landmarks.Reset(); }
+	}
+
+	if (!Landmarks) { BuildLandmarks(VtxUID, EdgeCosts); }
+
+	// Forwarded outputs point to the input itself, which is left untouched
+	if (SecondaryDataFacade->Source->GetOut() == SecondaryDataFacade->Source->GetIn()) { return; }
+
+	if (UPCGExClusterEdgesData* OutEdgesData = Cast<UPCGExClusterEdgesData>(SecondaryDataFacade->Source->GetOut()))
+	{
+		OutEdgesData->SetBoundLandmarks(Landmarks);
+	}
+}
+
+void UPCGExHeuristicLandmarks::BuildLandmarks(const uint64 InVtxUID, const TArray<double>& InEdgeCosts)
+{
+	Landmarks = MakeShared<PCGExHeuristics::FLandmarks>(InVtxUID);
+	Landmarks->Build(Cluster, NumLandmarks, InEdgeCosts);
+}
+
+UPCGExHeuristicOperation* UPCGExHeuristicsFactoryLandmarks::CreateOperation(FPCGExContext* InContext) const
+{
+	UPCGExHeuristicLandmarks* NewOperation = InContext->ManagedObjects->New<UPCGExHeuristicLandmarks>();
+	PCGEX_FORWARD_HEURISTIC_CONFIG
+	NewOperation->NumLandmarks = Config.NumLandmarks;
+	NewOperation->bGlobalScoreIsLowerBound = true; // Set before the handler sorts operations
+	return NewOperation;
+}
+
+UPCGExParamFactoryBase* UPCGExHeuristicsLandmarksProviderSettings::CreateFactory(FPCGExContext* InContext, UPCGExParamFactoryBase* InFactory) const
+{
+	UPCGExHeuristicsFactoryLandmarks* NewFactory = InContext->ManagedObjects->New<UPCGExHeuristicsFactoryLandmarks>();
+	PCGEX_FORWARD_HEURISTIC_FACTORY
+	return Super::CreateFactory(InContext, NewFactory);
+}
+
+#if WITH_EDITOR
+FString UPCGExHeuristicsLandmarksProviderSettings::GetDisplayName() const
+{
+	return GetDefaultNodeName().ToString()
+		+ TEXT(" @ ")
+		+ FString::Printf(TEXT("%.3f"), (static_cast<int32>(1000 * Config.WeightFactor) / 1000.0))
+		+ FString::Printf(TEXT(" (%d)"), Config.NumLandmarks);
+}
+#endif
@@ -28,8 +28,10 @@ namespace PCGExHeuristics
 	THeuristicsHandler::~THeuristicsHandler()
 	{
 		for (UPCGExHeuristicOperation* Op : Operations) { ExecutionContext->ManagedObjects->Destroy(Op); }
+		for (UPCGExHeuristicOperation* Op : LowerBoundOperations) { ExecutionContext->ManagedObjects->Destroy(Op); }
 
 		Operations.Empty();
+		LowerBoundOperations.Empty();
 		Feedbacks.Empty();
 	}
 
@@ -44,6 +46,7 @@ namespace PCGExHeuristics
 				if (!FeedbackFactory->IsGlobal())
 				{
 					LocalFeedbackFactories.Add(OperationFactory);
+					LocalFeedbackWeight += OperationFactory->WeightFactor;
 					continue;
 				}
 
@@ -55,7 +58,8 @@ namespace PCGExHeuristics
 				Operation = OperationFactory->CreateOperation(InContext);
 			}
 
-			Operations.Add(Operation);
+			if (Operation->bGlobalScoreIsLowerBound) { LowerBoundOperations.Add(Operation); }
+			else { Operations.Add(Operation); }
 
 			Operation->PrimaryDataFacade = VtxDataFacade;
 			Operation->SecondaryDataFacade = EdgeDataFacade;
@@ -67,7 +71,8 @@ namespace PCGExHeuristics
 
 		if (Operations.IsEmpty())
 		{
-			PCGE_LOG_C(Warning, GraphAndLog, InContext, FTEXT("Missing valid heuristics. Will use Shortest Distance as default. (Local feedback heuristics don't count)"));
+			// Lower bounds have no edge score of their own and rely on the default one
+			if (LowerBoundOperations.IsEmpty()) { PCGE_LOG_C(Warning, GraphAndLog, InContext, FTEXT("Missing valid heuristics. Will use Shortest Distance as default. (Local feedback heuristics don't count)")); }
 			UPCGExHeuristicDistance* DefaultHeuristics = InContext->ManagedObjects->New<UPCGExHeuristicDistance>();
 			DefaultHeuristics->ReferenceWeight = ReferenceWeight;
 			Operations.Add(DefaultHeuristics);
@@ -80,10 +85,21 @@ namespace PCGExHeuristics
 
 		CurrentCluster = InCluster;
 		bUseDynamicWeight = false;
+		bGlobalScoreUsesSeed = false;
+		bEdgeScoreUsesGoal = false;
 		for (UPCGExHeuristicOperation* Operation : Operations)
 		{
 			Operation->PrepareForCluster(InCluster);
 			if (Operation->bHasCustomLocalWeightMultiplier) { bUseDynamicWeight = true; }
+			if (Operation->bGlobalScoreUsesSeed) { bGlobalScoreUsesSeed = true; }
+			if (Operation->bEdgeScoreUsesGoal) { bEdgeScoreUsesGoal = true; }
+		}
+
+		for (UPCGExHeuristicOperation* Operation : LowerBoundOperations) { Operation->PrepareForCluster(InCluster); }
+
+		{
+			FWriteScopeLock WriteScopeLock(GlobalScoreBoundsLock);
+			GlobalScoreBounds.Empty();
 		}
 	}
 
@@ -91,6 +107,41 @@ namespace PCGExHeuristics
 	{
 		TotalStaticWeight = 0;
 		for (const UPCGExHeuristicOperation* Op : Operations) { TotalStaticWeight += Op->WeightFactor; }
+
+		// Lower bounds may precompute over edge scores, which are only complete now
+		for (UPCGExHeuristicOperation* Op : LowerBoundOperations) { Op->CompleteClusterPreparation(this); }
+	}
+
+	FVector2D THeuristicsHandler::GetGlobalScoreBounds(
+		const PCGExCluster::FNode& Seed,
+		const PCGExCluster::FNode& Goal)
+	{
+		const bool bCacheable = !HasGlobalFeedback();
+		const uint64 Key = PCGEx::H64(bGlobalScoreUsesSeed ? Seed.NodeIndex : 0, Goal.NodeIndex);
+
+		if (bCacheable)
+		{
+			FReadScopeLock ReadScopeLock(GlobalScoreBoundsLock);
+			if (const FVector2D* Bounds = GlobalScoreBounds.Find(Key)) { return *Bounds; }
+		}
+
+		TRACE_CPUPROFILER_EVENT_SCOPE(THeuristicsHandler::GetGlobalScoreBounds);
+
+		FVector2D Bounds = FVector2D(MAX_dbl, MIN_dbl);
+		for (const PCGExCluster::FNode& Node : *CurrentCluster->Nodes)
+		{
+			const double GS = GetGlobalScore(Node, Seed, Goal);
+			Bounds.X = FMath::Min(Bounds.X, GS);
+			Bounds.Y = FMath::Max(Bounds.Y, GS);
+		}
+
+		if (bCacheable)
+		{
+			FWriteScopeLock WriteScopeLock(GlobalScoreBoundsLock);
+			GlobalScoreBounds.Add(Key, Bounds);
+		}
+
+		return Bounds;
 	}
 
 	TSharedPtr<FLocalFeedbackHandler> THeuristicsHandler::MakeLocalFeedbackHandler(const PCGExCluster::FCluster* InCluster)
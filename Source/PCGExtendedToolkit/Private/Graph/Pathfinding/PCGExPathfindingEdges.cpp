@@ -28,12 +28,6 @@ void FPCGExPathfindingEdgesContext::TryFindPath(
 {
 	PCGEX_SETTINGS_LOCAL(PathfindingEdges)
 
-	const FPCGPoint& Seed = SeedsDataFacade->Source->GetInPoint(Query->SeedIndex);
-	const FPCGPoint& Goal = GoalsDataFacade->Source->GetInPoint(Query->GoalIndex);
-
-	PCGExCluster::FCluster* Cluster = SearchOperation->Cluster;
-	const TArray<int32>& VtxPointIndices = Cluster->GetVtxPointIndices();
-
 	TArray<int32> Path;
 
 	//Note: Can silently fail
@@ -45,6 +39,52 @@ void FPCGExPathfindingEdgesContext::TryFindPath(
 		return;
 	}
 
+	BuildPath(SearchOperation->Cluster, Query, Path);
+}
+
+void FPCGExPathfindingEdgesContext::TryFindPaths(
+	const UPCGExSearchOperation* SearchOperation,
+	const int32 SeedNodeIndex,
+	const TArray<int32>& QueryIndices,
+	const TSharedPtr<PCGExHeuristics::THeuristicsHandler>& HeuristicsHandler)
+{
+	PCGEX_SETTINGS_LOCAL(PathfindingEdges)
+
+	PCGExCluster::FCluster* Cluster = SearchOperation->Cluster;
+
+	TArray<int32> GoalNodeIndices;
+	GoalNodeIndices.SetNumUninitialized(QueryIndices.Num());
+
+	for (int i = 0; i < QueryIndices.Num(); i++)
+	{
+		const TSharedPtr<PCGExPathfinding::FPathQuery>& Query = PathQueries[QueryIndices[i]];
+		int32 GoalNodeIndex = Cluster->FindClosestNode(Query->GoalPosition, Settings->GoalPicking.PickingMethod, 1);
+		if (GoalNodeIndex != -1 && !Settings->GoalPicking.WithinDistance(Cluster->GetPos(GoalNodeIndex), Query->GoalPosition)) { GoalNodeIndex = -1; }
+		GoalNodeIndices[i] = GoalNodeIndex;
+	}
+
+	TArray<TArray<int32>> Paths;
+	SearchOperation->FindPaths(SeedNodeIndex, GoalNodeIndices, HeuristicsHandler, Paths);
+
+	for (int i = 0; i < QueryIndices.Num(); i++)
+	{
+		if (Paths[i].IsEmpty()) { continue; } // Failed
+		BuildPath(Cluster, PathQueries[QueryIndices[i]], Paths[i]);
+	}
+}
+
+void FPCGExPathfindingEdgesContext::BuildPath(
+	PCGExCluster::FCluster* Cluster,
+	const TSharedPtr<PCGExPathfinding::FPathQuery>& Query,
+	const TArray<int32>& Path)
+{
+	PCGEX_SETTINGS_LOCAL(PathfindingEdges)
+
+	const FPCGPoint& Seed = SeedsDataFacade->Source->GetInPoint(Query->SeedIndex);
+	const FPCGPoint& Goal = GoalsDataFacade->Source->GetInPoint(Query->GoalIndex);
+
+	const TArray<int32>& VtxPointIndices = Cluster->GetVtxPointIndices();
+
 	if (Path.Num() < 2 && !Settings->bAddSeedToPath && !Settings->bAddGoalToPath)
 	{
 		// Omit
@@ -188,10 +228,57 @@ namespace PCGExPathfindingEdge
 		return true;
 	}
 
+	bool FSampleClusterPathGroupTask::ExecuteTask(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager)
+	{
+		FPCGExPathfindingEdgesContext* Context = AsyncManager->GetContext<FPCGExPathfindingEdgesContext>();
+		Context->TryFindPaths(SearchOperation, SeedNodeIndex, QueryIndices, Heuristics);
+		return true;
+	}
+
 	FProcessor::~FProcessor()
 	{
 	}
 
+	void FProcessor::StartQueryGroups()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExPathfindingEdge::StartQueryGroups);
+
+		// Resolve seed nodes upfront so queries whose seeds snap to the same node share a search tree
+
+		TMap<int32, int32> GroupIndices;
+		TArray<int32> GroupSeeds;
+		TArray<TArray<int32>> Groups;
+
+		for (int i = 0; i < Context->PathQueries.Num(); i++)
+		{
+			const TSharedPtr<PCGExPathfinding::FPathQuery>& Query = Context->PathQueries[i];
+
+			const int32 SeedNodeIndex = Cluster->FindClosestNode(Query->SeedPosition, Settings->SeedPicking.PickingMethod, 1);
+			if (SeedNodeIndex == -1 || !Settings->SeedPicking.WithinDistance(Cluster->GetPos(SeedNodeIndex), Query->SeedPosition)) { continue; }
+
+			if (const int32* GroupIndex = GroupIndices.Find(SeedNodeIndex))
+			{
+				Groups[*GroupIndex].Add(i);
+				continue;
+			}
+
+			GroupIndices.Add(SeedNodeIndex, Groups.Num());
+			GroupSeeds.Add(SeedNodeIndex);
+			Groups.Emplace_GetRef().Add(i);
+		}
+
+		if (IsTrivial())
+		{
+			for (int i = 0; i < Groups.Num(); i++) { Context->TryFindPaths(SearchOperation, GroupSeeds[i], Groups[i], HeuristicsHandler); }
+			return;
+		}
+
+		for (int i = 0; i < Groups.Num(); i++)
+		{
+			AsyncManager->Start<FSampleClusterPathGroupTask>(i, VtxDataFacade->Source, SearchOperation, &Context->PathQueries, HeuristicsHandler, GroupSeeds[i], MoveTemp(Groups[i]));
+		}
+	}
+
 	bool FProcessor::Process(TSharedPtr<PCGExMT::FTaskManager> InAsyncManager)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExPathfindingEdge::Process);
@@ -216,6 +303,12 @@ namespace PCGExPathfindingEdge
 		SearchOperation = Context->SearchAlgorithm->CopyOperation<UPCGExSearchOperation>(); // Create a local copy
 		SearchOperation->PrepareForCluster(Cluster.Get());
 
+		if (Settings->bGroupQueriesBySeed && HeuristicsHandler->CanShareSearchTree())
+		{
+			StartQueryGroups();
+			return true;
+		}
+
 		if (IsTrivial())
 		{
 			// Naturally accounts for global heuristics
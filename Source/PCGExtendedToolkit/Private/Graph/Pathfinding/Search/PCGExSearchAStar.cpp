@@ -6,7 +6,7 @@
 
 #include "Graph/PCGExCluster.h"
 #include "Graph/Pathfinding/Heuristics/PCGExHeuristics.h"
-#include "Graph/Pathfinding/Search/PCGExScoredQueue.h"
+#include "Graph/Pathfinding/Search/PCGExSearchWorkspace.h"
 
 bool UPCGExSearchAStar::FindPath(
 	const FVector& SeedPosition,
@@ -28,59 +28,39 @@ bool UPCGExSearchAStar::FindPath(
 
 	if (SeedNode.NodeIndex == GoalNode.NodeIndex) { return false; }
 
-	const int32 NumNodes = NodesRef.Num();
-
 	TRACE_CPUPROFILER_EVENT_SCOPE(UPCGExSearchAStar::FindPath);
 
-	TBitArray<> Visited;
-	Visited.Init(false, NumNodes);
+	const FVector2D GScoreBounds = Heuristics->GetGlobalScoreBounds(SeedNode, GoalNode);
+	const double MinGScore = GScoreBounds.X;
+	const double MaxGScore = GScoreBounds.Y;
 
-	TArray<uint64> TravelStack;
-	TArray<double> GScore;
+	const PCGExSearch::FScopedWorkspace Workspace(WorkspacePool);
+	Workspace->Reset(SeedNode.NodeIndex, Heuristics->GetGlobalScore(SeedNode, SeedNode, GoalNode));
 
-	GScore.SetNum(NumNodes);
-	TravelStack.SetNum(NumNodes);
-	for (int i = 0; i < NumNodes; i++)
-	{
-		GScore[i] = -1;
-		TravelStack[i] = PCGEx::NH64(-1, -1);
-	}
-
-	double MinGScore = MAX_dbl;
-	double MaxGScore = MIN_dbl;
-
-	for (int i = 0; i < NodesRef.Num(); i++)
-	{
-		const double GS = Heuristics->GetGlobalScore(NodesRef[i], SeedNode, GoalNode);
-		MinGScore = FMath::Min(MinGScore, GS);
-		MaxGScore = FMath::Max(MaxGScore, GS);
-	}
-
-	const TUniquePtr<PCGExSearch::TScoredQueue> ScoredQueue = MakeUnique<PCGExSearch::TScoredQueue>(
-		NumNodes, SeedNode.NodeIndex, Heuristics->GetGlobalScore(SeedNode, SeedNode, GoalNode));
-	GScore[SeedNode.NodeIndex] = 0;
+	PCGExSearch::FIndexedScoredQueue& ScoredQueue = Workspace->ScoredQueue;
+	const TArray<uint64>& TravelStack = Workspace->TravelStack;
 
 	bool bSuccess = false;
 
 	int32 CurrentNodeIndex;
 	double CurrentFScore;
-	while (ScoredQueue->Dequeue(CurrentNodeIndex, CurrentFScore))
+	while (ScoredQueue.Dequeue(CurrentNodeIndex, CurrentFScore))
 	{
 		if (CurrentNodeIndex == GoalNode.NodeIndex) { break; } // Exit early
 
-		const double CurrentGScore = GScore[CurrentNodeIndex];
+		const double CurrentGScore = Workspace->GetGScore(CurrentNodeIndex);
 		const PCGExCluster::FNode& Current = NodesRef[CurrentNodeIndex];
 
-		if (Visited[CurrentNodeIndex]) { continue; }
-		Visited[CurrentNodeIndex] = true;
+		if (Workspace->IsVisited(CurrentNodeIndex)) { continue; }
+		Workspace->SetVisited(CurrentNodeIndex);
 
-		for (const uint64 AdjacencyHash : Current.Adjacency)
+		for (const uint64 AdjacencyHash : Cluster->GetLinks(CurrentNodeIndex))
 		{
 			uint32 NeighborIndex;
 			uint32 EdgeIndex;
 			PCGEx::H64(AdjacencyHash, NeighborIndex, EdgeIndex);
 
-			if (Visited[NeighborIndex]) { continue; }
+			if (Workspace->IsVisited(NeighborIndex)) { continue; }
 
 			const PCGExCluster::FNode& AdjacentNode = NodesRef[NeighborIndex];
 			const PCGExGraph::FIndexedEdge& Edge = EdgesRef[EdgeIndex];
@@ -88,20 +68,20 @@ bool UPCGExSearchAStar::FindPath(
 			const double EScore = Heuristics->GetEdgeScore(Current, AdjacentNode, Edge, SeedNode, GoalNode, LocalFeedback.Get(), &TravelStack);
 			const double TentativeGScore = CurrentGScore + EScore;
 
-			const double PreviousGScore = GScore[NeighborIndex];
+			const double PreviousGScore = Workspace->GetGScore(NeighborIndex);
 			if (PreviousGScore != -1 && TentativeGScore >= PreviousGScore) { continue; }
 
-			TravelStack[NeighborIndex] = PCGEx::NH64(CurrentNodeIndex, EdgeIndex);
-			GScore[NeighborIndex] = TentativeGScore;
+			Workspace->Set(NeighborIndex, TentativeGScore, PCGEx::NH64(CurrentNodeIndex, EdgeIndex));
 
-			const double GS = PCGExMath::Remap(Heuristics->GetGlobalScore(AdjacentNode, SeedNode, GoalNode), MinGScore, MaxGScore, 0, 1);
-			const double FScore = TentativeGScore + GS * Heuristics->ReferenceWeight; //TODO: Need to weight this properly
+			const double GS = MaxGScore > MinGScore ? PCGExMath::Remap(Heuristics->GetGlobalScore(AdjacentNode, SeedNode, GoalNode), MinGScore, MaxGScore, 0, 1) : 0;
+			const double FScore = TentativeGScore + GS * Heuristics->ReferenceWeight //TODO: Need to weight this properly
+				+ Heuristics->GetLowerBoundScore(AdjacentNode, SeedNode, GoalNode); // Already in edge score units, never remapped
 
-			ScoredQueue->Enqueue(NeighborIndex, FScore);
+			ScoredQueue.Enqueue(NeighborIndex, FScore);
 		}
 	}
 
-	uint64 PathHash = TravelStack[GoalNode.NodeIndex];
+	uint64 PathHash = Workspace->GetTravel(GoalNode.NodeIndex);
 	int32 PathNodeIndex;
 	int32 PathEdgeIndex;
 	PCGEx::NH64(PathHash, PathNodeIndex, PathEdgeIndex);
@@ -133,7 +113,7 @@ bool UPCGExSearchAStar::FindPath(
 			const int32 CurrentIndex = PathNodeIndex;
 			Path.Add(CurrentIndex);
 
-			PathHash = TravelStack[PathNodeIndex];
+			PathHash = Workspace->GetTravel(PathNodeIndex);
 			PCGEx::NH64(PathHash, PathNodeIndex, PathEdgeIndex);
 
 			const PCGExCluster::FNode& N = NodesRef[CurrentIndex];
@@ -154,8 +134,5 @@ bool UPCGExSearchAStar::FindPath(
 		OutPath.Append(Path);
 	}
 
-	TravelStack.Empty();
-	GScore.Empty();
-
 	return bSuccess;
 }
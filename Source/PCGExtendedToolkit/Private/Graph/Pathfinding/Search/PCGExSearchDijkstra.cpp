@@ -6,7 +6,7 @@
 
 #include "Graph/PCGExCluster.h"
 #include "Graph/Pathfinding/Heuristics/PCGExHeuristics.h"
-#include "Graph/Pathfinding/Search/PCGExScoredQueue.h"
+#include "Graph/Pathfinding/Search/PCGExSearchWorkspace.h"
 
 void UPCGExSearchDijkstra::CopySettingsFrom(const UPCGExOperation* Other)
 {
@@ -33,63 +33,50 @@ bool UPCGExSearchDijkstra::FindPath(
 
 	if (SeedNode.NodeIndex == GoalNode.NodeIndex) { return false; }
 
-	const int32 NumNodes = NodesRef.Num();
-
 	TRACE_CPUPROFILER_EVENT_SCOPE(UPCGExSearchDijkstra::FindPath);
 
 	// Basic Dijkstra implementation
 
-	TBitArray<> Visited;
-	Visited.Init(false, NumNodes);
-
-	TArray<uint64> TravelStack;
-
-	const TUniquePtr<PCGExSearch::TScoredQueue> ScoredQueue = MakeUnique<PCGExSearch::TScoredQueue>(
-		NumNodes, SeedNode.NodeIndex, 0);
-
-	TravelStack.SetNumUninitialized(NumNodes);
-	for (int i = 0; i < NumNodes; i++)
-	{
-		ScoredQueue->Scores[i] = -1;
-		TravelStack[i] = PCGEx::NH64(-1, -1);
-	}
+	const PCGExSearch::FScopedWorkspace Workspace(WorkspacePool);
+	Workspace->Reset(SeedNode.NodeIndex, 0);
 
-	ScoredQueue->Scores[SeedNode.NodeIndex] = 0;
+	PCGExSearch::FIndexedScoredQueue& ScoredQueue = Workspace->ScoredQueue;
+	const TArray<uint64>& TravelStack = Workspace->TravelStack;
 
 	int32 CurrentNodeIndex;
 	double CurrentScore;
-	while (ScoredQueue->Dequeue(CurrentNodeIndex, CurrentScore))
+	while (ScoredQueue.Dequeue(CurrentNodeIndex, CurrentScore))
 	{
 		if (CurrentNodeIndex == GoalNode.NodeIndex) { break; } // Exit early
 
 		const PCGExCluster::FNode& Current = NodesRef[CurrentNodeIndex];
 
-		if (Visited[CurrentNodeIndex]) { continue; }
-		Visited[CurrentNodeIndex] = true;
+		if (Workspace->IsVisited(CurrentNodeIndex)) { continue; }
+		Workspace->SetVisited(CurrentNodeIndex);
 
-		for (const uint64 AdjacencyHash : Current.Adjacency)
+		for (const uint64 AdjacencyHash : Cluster->GetLinks(CurrentNodeIndex))
 		{
 			uint32 NeighborIndex;
 			uint32 EdgeIndex;
 			PCGEx::H64(AdjacencyHash, NeighborIndex, EdgeIndex);
 
-			if (Visited[NeighborIndex]) { continue; }
+			if (Workspace->IsVisited(NeighborIndex)) { continue; }
 
 			const PCGExCluster::FNode& AdjacentNode = NodesRef[NeighborIndex];
 			const PCGExGraph::FIndexedEdge& Edge = EdgesRef[EdgeIndex];
 
 			const double AltScore = CurrentScore + Heuristics->GetEdgeScore(Current, AdjacentNode, Edge, SeedNode, GoalNode, LocalFeedback.Get(), &TravelStack);
-			const double PreviousScore = ScoredQueue->Scores[NeighborIndex];
+			const double PreviousScore = Workspace->GetGScore(NeighborIndex);
 			if (PreviousScore != -1 && AltScore >= PreviousScore) { continue; }
 
-			ScoredQueue->Enqueue(NeighborIndex, AltScore);
-			TravelStack[NeighborIndex] = PCGEx::NH64(CurrentNodeIndex, EdgeIndex);
+			Workspace->Set(NeighborIndex, AltScore, PCGEx::NH64(CurrentNodeIndex, EdgeIndex));
+			ScoredQueue.Enqueue(NeighborIndex, AltScore);
 		}
 	}
 
 	TArray<int32> Path;
 
-	uint64 PathHash = TravelStack[GoalNode.NodeIndex];
+	uint64 PathHash = Workspace->GetTravel(GoalNode.NodeIndex);
 	int32 PathNodeIndex;
 	int32 PathEdgeIndex;
 	PCGEx::NH64(PathHash, PathNodeIndex, PathEdgeIndex);
@@ -115,7 +102,7 @@ bool UPCGExSearchDijkstra::FindPath(
 		const int32 CurrentIndex = PathNodeIndex;
 		Path.Add(CurrentIndex);
 
-		PathHash = TravelStack[PathNodeIndex];
+		PathHash = Workspace->GetTravel(PathNodeIndex);
 		PCGEx::NH64(PathHash, PathNodeIndex, PathEdgeIndex);
 
 		const PCGExCluster::FNode& N = NodesRef[CurrentIndex];
@@ -4,6 +4,9 @@
 
 #include "Graph/Pathfinding/Search/PCGExSearchOperation.h"
 
+#include "Algo/Reverse.h"
+#include "Graph/Pathfinding/Search/PCGExSearchWorkspace.h"
+
 void UPCGExSearchOperation::CopySettingsFrom(const UPCGExOperation* Other)
 {
 	Super::CopySettingsFrom(Other);
@@ -12,6 +15,7 @@ void UPCGExSearchOperation::CopySettingsFrom(const UPCGExOperation* Other)
 void UPCGExSearchOperation::PrepareForCluster(PCGExCluster::FCluster* InCluster)
 {
 	Cluster = InCluster;
+	WorkspacePool = MakeShared<PCGExSearch::FSearchWorkspacePool>(Cluster->Nodes->Num());
 }
 
 bool UPCGExSearchOperation::FindPath(
@@ -25,3 +29,88 @@ bool UPCGExSearchOperation::FindPath(
 {
 	return false;
 }
+
+void UPCGExSearchOperation::FindPaths(
+	const int32 SeedNodeIndex,
+	const TArray<int32>& GoalNodeIndices,
+	const TSharedPtr<PCGExHeuristics::THeuristicsHandler>& Heuristics,
+	TArray<TArray<int32>>& OutPaths) const
+{
+	const TArray<PCGExCluster::FNode>& NodesRef = *Cluster->Nodes;
+	const TArray<PCGExGraph::FIndexedEdge>& EdgesRef = *Cluster->Edges;
+
+	OutPaths.SetNum(GoalNodeIndices.Num());
+
+	TSet<int32> PendingGoals;
+	PendingGoals.Reserve(GoalNodeIndices.Num());
+	for (const int32 GoalNodeIndex : GoalNodeIndices) { if (GoalNodeIndex != -1 && GoalNodeIndex != SeedNodeIndex) { PendingGoals.Add(GoalNodeIndex); } }
+
+	int32 NumPendingGoals = PendingGoals.Num();
+	if (NumPendingGoals == 0) { return; }
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPCGExSearchOperation::FindPaths);
+
+	const PCGExCluster::FNode& SeedNode = NodesRef[SeedNodeIndex];
+
+	const PCGExSearch::FScopedWorkspace Workspace(WorkspacePool);
+	Workspace->Reset(SeedNodeIndex, 0);
+
+	PCGExSearch::FIndexedScoredQueue& ScoredQueue = Workspace->ScoredQueue;
+	const TArray<uint64>& TravelStack = Workspace->TravelStack;
+
+	// Shared tree is plain Dijkstra : there is no single goal to steer toward.
+	// Edge scores are goal-agnostic here, so the seed stands in for the goal.
+
+	int32 CurrentNodeIndex;
+	double CurrentScore;
+	while (ScoredQueue.Dequeue(CurrentNodeIndex, CurrentScore))
+	{
+		if (Workspace->IsVisited(CurrentNodeIndex)) { continue; }
+		Workspace->SetVisited(CurrentNodeIndex);
+
+		if (PendingGoals.Contains(CurrentNodeIndex) && --NumPendingGoals == 0) { break; } // Every goal is settled
+
+		const PCGExCluster::FNode& Current = NodesRef[CurrentNodeIndex];
+
+		for (const uint64 AdjacencyHash : Cluster->GetLinks(CurrentNodeIndex))
+		{
+			uint32 NeighborIndex;
+			uint32 EdgeIndex;
+			PCGEx::H64(AdjacencyHash, NeighborIndex, EdgeIndex);
+
+			if (Workspace->IsVisited(NeighborIndex)) { continue; }
+
+			const double AltScore = CurrentScore + Heuristics->GetEdgeScore(Current, NodesRef[NeighborIndex], EdgesRef[EdgeIndex], SeedNode, SeedNode, nullptr, &TravelStack);
+			const double PreviousScore = Workspace->GetGScore(NeighborIndex);
+			if (PreviousScore != -1 && AltScore >= PreviousScore) { continue; }
+
+			Workspace->Set(NeighborIndex, AltScore, PCGEx::NH64(CurrentNodeIndex, EdgeIndex));
+			ScoredQueue.Enqueue(NeighborIndex, AltScore);
+		}
+	}
+
+	for (int i = 0; i < GoalNodeIndices.Num(); i++)
+	{
+		const int32 GoalNodeIndex = GoalNodeIndices[i];
+		if (GoalNodeIndex == -1 || GoalNodeIndex == SeedNodeIndex || !Workspace->IsVisited(GoalNodeIndex)) { continue; }
+
+		TArray<int32>& Path = OutPaths[i];
+
+		int32 PathNodeIndex = GoalNodeIndex;
+		int32 PathEdgeIndex;
+		while (PathNodeIndex != -1)
+		{
+			Path.Add(PathNodeIndex);
+			PCGEx::NH64(Workspace->GetTravel(PathNodeIndex), PathNodeIndex, PathEdgeIndex);
+		}
+
+		Algo::Reverse(Path);
+	}
+}
+
+void UPCGExSearchOperation::Cleanup()
+{
+	Cluster = nullptr;
+	WorkspacePool.Reset();
+	Super::Cleanup();
+}
@@ -37,6 +37,42 @@ bool PCGExPointsFilter::TBitmaskFilter::Init(const FPCGContext* InContext, const
 	return true;
 }
 
+void PCGExPointsFilter::TBitmaskFilter::TestScope(const int32 StartIndex, const int32 Count, uint64* InOutMask) const
+{
+	const TArrayView<const int64> Flags = FlagsReader->ReadSpan(StartIndex, Count);
+	const TArrayView<const int64> Masks = MaskReader ? MaskReader->ReadSpan(StartIndex, Count) : TArrayView<const int64>();
+	const int64 ConstantMask = Bitmask;
+	const bool bInvert = TypedFilterFactory->Config.bInvertResult;
+
+	auto ForEachMask = [&](auto&& Test)
+	{
+		if (MaskReader) { PCGExPointFilter::AndMask(Count, InOutMask, [&](const int32 i) { return Test(Flags[i], Masks[i]) != bInvert; }); }
+		else { PCGExPointFilter::AndMask(Count, InOutMask, [&](const int32 i) { return Test(Flags[i], ConstantMask) != bInvert; }); }
+	};
+
+	switch (TypedFilterFactory->Config.Comparison)
+	{
+	case EPCGExBitflagComparison::MatchPartial:
+		ForEachMask([](const int64 F, const int64 M) { return (F & M) != 0; });
+		break;
+	case EPCGExBitflagComparison::MatchFull:
+		ForEachMask([](const int64 F, const int64 M) { return (F & M) == M; });
+		break;
+	case EPCGExBitflagComparison::MatchStrict:
+		ForEachMask([](const int64 F, const int64 M) { return F == M; });
+		break;
+	case EPCGExBitflagComparison::NoMatchPartial:
+		ForEachMask([](const int64 F, const int64 M) { return (F & M) == 0; });
+		break;
+	case EPCGExBitflagComparison::NoMatchFull:
+		ForEachMask([](const int64 F, const int64 M) { return (F & M) != M; });
+		break;
+	default:
+		FFilter::TestScope(StartIndex, Count, InOutMask);
+		break;
+	}
+}
+
 PCGEX_CREATE_FILTER_FACTORY(Bitmask)
 
 #if WITH_EDITOR
@@ -38,6 +38,23 @@ bool PCGExPointsFilter::FBooleanComparisonFilter::Init(const FPCGContext* InCont
 	return true;
 }
 
+void PCGExPointsFilter::FBooleanComparisonFilter::TestScope(const int32 StartIndex, const int32 Count, uint64* InOutMask) const
+{
+	const TArrayView<const bool> A = OperandA->ReadSpan(StartIndex, Count);
+	const bool bEqual = TypedFilterFactory->Config.Comparison == EPCGExEquality::Equal;
+
+	if (OperandB)
+	{
+		const TArrayView<const bool> B = OperandB->ReadSpan(StartIndex, Count);
+		PCGExPointFilter::AndMask(Count, InOutMask, [&](const int32 i) { return (A[i] == B[i]) == bEqual; });
+	}
+	else
+	{
+		const bool B = TypedFilterFactory->Config.OperandBConstant;
+		PCGExPointFilter::AndMask(Count, InOutMask, [&](const int32 i) { return (A[i] == B) == bEqual; });
+	}
+}
+
 PCGEX_CREATE_FILTER_FACTORY(BooleanCompare)
 
 #if WITH_EDITOR
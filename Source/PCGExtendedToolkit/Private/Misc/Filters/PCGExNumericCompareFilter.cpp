@@ -38,6 +38,48 @@ bool PCGExPointsFilter::TNumericComparisonFilter::Init(const FPCGContext* InCont
 	return true;
 }
 
+namespace PCGExPointsFilter
+{
+	template <typename FGetB>
+	static void CompareScope(const EPCGExComparison Comparison, const double Tolerance, const TArrayView<const double>& A, FGetB&& GetB, const int32 Count, uint64* InOutMask)
+	{
+		// Comparison is resolved once per scope rather than once per point
+		switch (Comparison)
+		{
+#define PCGEX_COMPARE_SCOPE(_COMPARISON, _TEST) case EPCGExComparison::_COMPARISON: PCGExPointFilter::AndMask(Count, InOutMask, [&](const int32 i) { return _TEST; }); break;
+		PCGEX_COMPARE_SCOPE(StrictlyEqual, A[i] == GetB(i))
+		PCGEX_COMPARE_SCOPE(StrictlyNotEqual, A[i] != GetB(i))
+		PCGEX_COMPARE_SCOPE(EqualOrGreater, A[i] >= GetB(i))
+		PCGEX_COMPARE_SCOPE(EqualOrSmaller, A[i] <= GetB(i))
+		PCGEX_COMPARE_SCOPE(StrictlyGreater, A[i] > GetB(i))
+		PCGEX_COMPARE_SCOPE(StrictlySmaller, A[i] < GetB(i))
+		PCGEX_COMPARE_SCOPE(NearlyEqual, FMath::Abs(A[i] - GetB(i)) <= Tolerance)
+		PCGEX_COMPARE_SCOPE(NearlyNotEqual, FMath::Abs(A[i] - GetB(i)) > Tolerance)
+#undef PCGEX_COMPARE_SCOPE
+		default:
+			FMemory::Memzero(InOutMask, PCGExPointFilter::NumMaskWords(Count) * sizeof(uint64));
+			break;
+		}
+	}
+}
+
+void PCGExPointsFilter::TNumericComparisonFilter::TestScope(const int32 StartIndex, const int32 Count, uint64* InOutMask) const
+{
+	const FPCGExNumericCompareFilterConfig& Config = TypedFilterFactory->Config;
+	const TArrayView<const double> A = OperandA->ReadSpan(StartIndex, Count);
+
+	if (OperandB)
+	{
+		const TArrayView<const double> B = OperandB->ReadSpan(StartIndex, Count);
+		CompareScope(Config.Comparison, Config.Tolerance, A, [&](const int32 i) { return B[i]; }, Count, InOutMask);
+	}
+	else
+	{
+		const double B = Config.OperandBConstant;
+		CompareScope(Config.Comparison, Config.Tolerance, A, [&](const int32) { return B; }, Count, InOutMask);
+	}
+}
+
 PCGEX_CREATE_FILTER_FACTORY(NumericCompare)
 
 #if WITH_EDITOR
@@ -33,6 +33,17 @@ bool PCGExPointsFilter::TWithinRangeFilter::Init(const FPCGContext* InContext, c
 	return true;
 }
 
+void PCGExPointsFilter::TWithinRangeFilter::TestScope(const int32 StartIndex, const int32 Count, uint64* InOutMask) const
+{
+	const TArrayView<const double> Values = OperandA->ReadSpan(StartIndex, Count);
+	const double Min = RealMin;
+	const double Max = RealMax;
+	const bool bInv = bInvert;
+
+	if (bInclusive) { PCGExPointFilter::AndMask(Count, InOutMask, [&](const int32 i) { return (Values[i] >= Min && Values[i] <= Max) != bInv; }); }
+	else { PCGExPointFilter::AndMask(Count, InOutMask, [&](const int32 i) { return (Values[i] >= Min && Values[i] < Max) != bInv; }); }
+}
+
 PCGEX_CREATE_FILTER_FACTORY(WithinRange)
 
 #if WITH_EDITOR
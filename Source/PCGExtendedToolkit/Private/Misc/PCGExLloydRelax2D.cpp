@@ -107,39 +107,20 @@ namespace PCGExLloydRelax2D
 	{
 		NumIterations--;
 
-		TUniquePtr<PCGExGeo::TDelaunay2> Delaunay = MakeUnique<PCGExGeo::TDelaunay2>();
 		TArray<FVector>& Positions = Processor->ActivePositions;
+		PCGExGeo::TLloydCells<3>& Cells = Processor->Cells;
 
-		//FPCGExPointsProcessorContext* Context = static_cast<FPCGExPointsProcessorContext*>(Manager->Context);
-
-		const TArrayView<FVector> View = MakeArrayView(Positions);
-		if (!Delaunay->Process(View, Processor->ProjectionDetails)) { return false; }
-
-		const int32 NumPoints = Positions.Num();
-
-		TArray<FVector> Sum;
-		TArray<double> Counts;
-		Sum.Append(Processor->ActivePositions);
-		Counts.SetNum(NumPoints);
-		for (int i = 0; i < NumPoints; i++) { Counts[i] = 1; }
-
-		FVector Centroid;
-		for (const PCGExGeo::FDelaunaySite2& Site : Delaunay->Sites)
+		if (Cells.NeedsRebuild(Positions))
 		{
-			PCGExGeo::GetCentroid(Positions, Site.Vtx, Centroid);
-			for (const int32 PtIndex : Site.Vtx)
-			{
-				Counts[PtIndex] += 1;
-				Sum[PtIndex] += Centroid;
-			}
-		}
+			const TUniquePtr<PCGExGeo::TDelaunay2> Delaunay = MakeUnique<PCGExGeo::TDelaunay2>();
+			const TArrayView<FVector> View = MakeArrayView(Positions);
+			if (!Delaunay->Process(View, Processor->ProjectionDetails)) { return false; }
 
-		if (InfluenceSettings->bProgressiveInfluence)
-		{
-			for (int i = 0; i < NumPoints; i++) { Positions[i] = FMath::Lerp(Positions[i], Sum[i] / Counts[i], InfluenceSettings->GetInfluence(i)); }
+			Cells.Build(Delaunay->Sites, Delaunay->DelaunayEdges, Positions, Processor->Settings->RebuildThreshold);
 		}
 
-		Delaunay.Reset();
+		const double MaxDisplacement = Cells.Relax(Positions, *InfluenceSettings);
+		if (MaxDisplacement <= FMath::Square(Processor->Settings->ConvergenceThreshold)) { return true; } // Converged
 
 		if (NumIterations > 0)
 		{
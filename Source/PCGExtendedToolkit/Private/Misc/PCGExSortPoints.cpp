@@ -66,69 +66,226 @@ bool FPCGExSortPointsBaseElement::ExecuteInternal(FPCGContext* InContext) const
 
 namespace PCGExSortPoints
 {
-	bool FProcessor::Process(const TSharedPtr<PCGExMT::FTaskManager> InAsyncManager)
+	constexpr int32 SortChunkSize = 16384;
+
+	/** Calls Body(Start, Count) over chunks of [0..Num), in parallel. */
+	template <typename FBody>
+	static void ForEachChunk(const int32 Num, FBody&& Body)
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExSortPoints::Process);
-		const UPCGExSortPointsBaseSettings* Settings = ExecutionContext->GetInputSettings<UPCGExSortPointsBaseSettings>();
-		check(Settings);
+		const int32 NumChunks = FMath::DivideAndRoundUp(Num, SortChunkSize);
+		ParallelFor(
+			NumChunks, [&](const int32 ChunkIndex)
+			{
+				const int32 Start = ChunkIndex * SortChunkSize;
+				Body(Start, FMath::Min(SortChunkSize, Num - Start));
+			}, NumChunks <= 1);
+	}
 
-		if (!FPointsProcessor::Process(InAsyncManager)) { return false; }
+	/** Order-preserving mapping of a double onto an unsigned integer. */
+	FORCEINLINE static uint64 ToSortableKey(const double Value)
+	{
+		const uint64 Bits = FMath::AsUInt(Value + 0.0); // Folds -0 into 0
+		return (Bits & (1ULL << 63)) ? ~Bits : Bits | (1ULL << 63);
+	}
 
-		TArray<FPCGExSortRuleConfig> RuleConfigs;
-		Settings->GetSortingRules(ExecutionContext, RuleConfigs);
+	/** Stable LSD radix sort of Order by Keys, one byte per pass. Passes where all keys share the same byte are skipped. */
+	static void RadixSort(TArray<uint64>& Keys, TArray<int32>& Order)
+	{
+		constexpr int32 NumBuckets = 256;
 
-		TArray<TSharedPtr<FPCGExSortRule>> Rules;
-		Rules.Reserve(RuleConfigs.Num());
+		const int32 Num = Keys.Num();
+		const int32 NumChunks = FMath::DivideAndRoundUp(Num, SortChunkSize);
 
-		TMap<PCGMetadataEntryKey, int32> PointIndices;
-		PointDataFacade->Source->PrintOutKeysMap(PointIndices);
+		uint64 Varying = 0;
+		for (int i = 1; i < Num; i++) { Varying |= Keys[i] ^ Keys[0]; }
+		if (!Varying) { return; }
 
-		for (const FPCGExSortRuleConfig& RuleConfig : RuleConfigs)
+		TArray<uint64> KeysBuffer;
+		TArray<int32> OrderBuffer;
+		KeysBuffer.SetNumUninitialized(Num);
+		OrderBuffer.SetNumUninitialized(Num);
+
+		TArray<int32> Offsets;
+		Offsets.SetNumUninitialized(NumChunks * NumBuckets);
+
+		uint64* SourceKeys = Keys.GetData();
+		int32* SourceOrder = Order.GetData();
+		uint64* TargetKeys = KeysBuffer.GetData();
+		int32* TargetOrder = OrderBuffer.GetData();
+
+		for (int32 Shift = 0; Shift < 64; Shift += 8)
 		{
-			TSharedPtr<FPCGExSortRule> NewRule = MakeShared<FPCGExSortRule>();
-			const TSharedPtr<PCGExData::TBuffer<double>> Cache = PointDataFacade->GetBroadcaster<double>(RuleConfig.Selector);
+			if (!((Varying >> Shift) & 0xFF)) { continue; }
 
-			if (!Cache)
+			ForEachChunk(
+				Num, [&](const int32 Start, const int32 Count)
+				{
+					int32* Histogram = Offsets.GetData() + (Start / SortChunkSize) * NumBuckets;
+					FMemory::Memzero(Histogram, NumBuckets * sizeof(int32));
+					for (int i = Start; i < Start + Count; i++) { Histogram[(SourceKeys[i] >> Shift) & 0xFF]++; }
+				});
+
+			// Bucket-major prefix sum, so each chunk scatters into its own slice of every bucket
+			int32 Sum = 0;
+			for (int b = 0; b < NumBuckets; b++)
 			{
-				PCGE_LOG_C(Warning, GraphAndLog, ExecutionContext, FTEXT("Some points are missing attributes used for sorting."));
-				continue;
+				for (int c = 0; c < NumChunks; c++)
+				{
+					int32& Offset = Offsets[c * NumBuckets + b];
+					const int32 Count = Offset;
+					Offset = Sum;
+					Sum += Count;
+				}
 			}
 
-			NewRule->Cache = Cache;
-			NewRule->Tolerance = RuleConfig.Tolerance;
-			NewRule->bInvertRule = RuleConfig.bInvertRule;
-			Rules.Add(NewRule);
+			ForEachChunk(
+				Num, [&](const int32 Start, const int32 Count)
+				{
+					int32* Offset = Offsets.GetData() + (Start / SortChunkSize) * NumBuckets;
+					for (int i = Start; i < Start + Count; i++)
+					{
+						const int32 Index = Offset[(SourceKeys[i] >> Shift) & 0xFF]++;
+						TargetKeys[Index] = SourceKeys[i];
+						TargetOrder[Index] = SourceOrder[i];
+					}
+				});
+
+			Swap(SourceKeys, TargetKeys);
+			Swap(SourceOrder, TargetOrder);
 		}
 
-		if (Rules.IsEmpty())
+		if (SourceOrder != Order.GetData())
 		{
-			// Don't sort
-			PointIndices.Empty();
-			return false;
+			Keys = MoveTemp(KeysBuffer);
+			Order = MoveTemp(OrderBuffer);
 		}
+	}
+
+	FPointSorter::FPointSorter(const TSharedRef<PCGExData::FFacade>& InDataFacade, const TArray<FPCGExSortRuleConfig>& InRuleConfigs)
+		: DataFacade(InDataFacade), RuleConfigs(InRuleConfigs)
+	{
+	}
+
+	bool FPointSorter::Init(FPCGExContext* InContext)
+	{
+		Rules.Reset(RuleConfigs.Num());
 
-		auto SortPredicate = [&](const FPCGPoint& A, const FPCGPoint& B)
+		for (const FPCGExSortRuleConfig& RuleConfig : RuleConfigs)
 		{
-			int Result = 0;
-			for (const TSharedPtr<FPCGExSortRule>& Rule : Rules)
+			const TSharedPtr<PCGExData::TBuffer<double>> Cache = DataFacade->GetBroadcaster<double>(RuleConfig.Selector);
+
+			if (!Cache)
 			{
-				const double ValueA = Rule->Cache->Read(PointIndices[A.MetadataEntry]);
-				const double ValueB = Rule->Cache->Read(PointIndices[B.MetadataEntry]);
-				Result = FMath::IsNearlyEqual(ValueA, ValueB, Rule->Tolerance) ? 0 : ValueA < ValueB ? -1 : 1;
-				if (Result != 0)
+				PCGE_LOG_C(Warning, GraphAndLog, InContext, FTEXT("Some points are missing attributes used for sorting."));
+				continue;
+			}
+
+			FPCGExSortRule& NewRule = Rules.Emplace_GetRef();
+			NewRule.Cache = Cache;
+			NewRule.Tolerance = RuleConfig.Tolerance;
+			NewRule.bInvertRule = RuleConfig.bInvertRule;
+		}
+
+		return !Rules.IsEmpty();
+	}
+
+	void FPointSorter::BuildKeys(TArray<uint64>& OutKeys) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExSortPoints::FPointSorter::BuildKeys);
+
+		const int32 NumPoints = DataFacade->GetNum();
+		const int32 NumRules = Rules.Num();
+
+		OutKeys.SetNumUninitialized(NumPoints * NumRules);
+
+		ForEachChunk(
+			NumPoints, [&](const int32 Start, const int32 Count)
+			{
+				for (int r = 0; r < NumRules; r++)
 				{
-					if (Rule->bInvertRule) { Result *= -1; }
-					break;
+					const FPCGExSortRule& Rule = Rules[r];
+					const TArrayView<const double> Values = Rule.Cache->ReadSpan(Start, Count);
+					const double InvTolerance = Rule.Tolerance > 0 ? 1 / Rule.Tolerance : 0;
+					const uint64 Flip = Rule.bInvertRule != (SortDirection == EPCGExSortDirection::Descending) ? MAX_uint64 : 0;
+
+					// Keys are point-major so multi-rule comparisons stay within a cache line
+					uint64* Keys = OutKeys.GetData() + Start * NumRules + r;
+					for (int i = 0; i < Count; i++)
+					{
+						const double Value = InvTolerance > 0 ? FMath::FloorToDouble(Values[i] * InvTolerance) : Values[i];
+						Keys[i * NumRules] = ToSortableKey(Value) ^ Flip;
+					}
 				}
-			}
+			});
+	}
+
+	void FPointSorter::SortIndices(TArray<int32>& OutOrder) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExSortPoints::FPointSorter::SortIndices);
+
+		const int32 NumPoints = DataFacade->GetNum();
+		const int32 NumRules = Rules.Num();
+
+		OutOrder.SetNumUninitialized(NumPoints);
+		for (int i = 0; i < NumPoints; i++) { OutOrder[i] = i; }
+
+		if (NumRules == 0 || NumPoints < 2) { return; }
+
+		TArray<uint64> Keys;
+		BuildKeys(Keys);
+
+		if (NumRules == 1)
+		{
+			RadixSort(Keys, OutOrder);
+			return;
+		}
+
+		// Index tie-break keeps the merge sort stable regardless of how chunks are sorted
+		PCGExMT::ParallelSort(
+			OutOrder, [&](const int32 A, const int32 B)
+			{
+				const uint64* KeyA = Keys.GetData() + A * NumRules;
+				const uint64* KeyB = Keys.GetData() + B * NumRules;
+				for (int r = 0; r < NumRules; r++) { if (KeyA[r] != KeyB[r]) { return KeyA[r] < KeyB[r]; } }
+				return A < B;
+			}, SortChunkSize);
+	}
+
+	void FPointSorter::Sort() const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExSortPoints::FPointSorter::Sort);
+
+		TArray<int32> Order;
+		SortIndices(Order);
+
+		TArray<FPCGPoint>& Points = DataFacade->GetOut()->GetMutablePoints();
+		const TArray<FPCGPoint> UnsortedPoints = MoveTemp(Points);
+
+		Points.SetNumUninitialized(UnsortedPoints.Num());
+		ForEachChunk(
+			Points.Num(), [&](const int32 Start, const int32 Count)
+			{
+				for (int i = Start; i < Start + Count; i++) { Points[i] = UnsortedPoints[Order[i]]; }
+			});
+	}
+
+	bool FProcessor::Process(const TSharedPtr<PCGExMT::FTaskManager> InAsyncManager)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExSortPoints::Process);
+		const UPCGExSortPointsBaseSettings* Settings = ExecutionContext->GetInputSettings<UPCGExSortPointsBaseSettings>();
+		check(Settings);
+
+		if (!FPointsProcessor::Process(InAsyncManager)) { return false; }
+
+		TArray<FPCGExSortRuleConfig> RuleConfigs;
+		Settings->GetSortingRules(ExecutionContext, RuleConfigs);
 
-			if (Settings->SortDirection == EPCGExSortDirection::Descending) { Result *= -1; }
-			return Result < 0;
-		};
+		FPointSorter Sorter(PointDataFacade, RuleConfigs);
+		Sorter.SortDirection = Settings->SortDirection;
 
-		PointDataFacade->GetOut()->GetMutablePoints().Sort(SortPredicate);
+		if (!Sorter.Init(ExecutionContext)) { return false; } // Don't sort
 
-		PointIndices.Empty();
+		Sorter.Sort();
 		return true;
 	}
 
@@ -244,6 +244,11 @@ void FPCGExContext::LoadAssets()
 }
 
 void FPCGExContext::AttachManageComponent(AActor* InParent, USceneComponent* InComponent, const FAttachmentTransformRules& AttachmentRules) const
+{
+	AttachManageComponent(InParent, InComponent, NewObject<UPCGManagedComponent>(SourceComponent.Get()), AttachmentRules);
+}
+
+void FPCGExContext::AttachManageComponent(AActor* InParent, USceneComponent* InComponent, UPCGManagedComponent* InManagedComponent, const FAttachmentTransformRules& AttachmentRules) const
 {
 	UPCGComponent* SrcComp = SourceComponent.Get();
 
@@ -263,9 +268,8 @@ void FPCGExContext::AttachManageComponent(AActor* InParent, USceneComponent* InC
 	InComponent->ComponentTags.Add(SrcComp->GetFName());
 	InComponent->ComponentTags.Add(PCGHelpers::DefaultPCGTag);
 
-	UPCGManagedComponent* ManagedComponent = NewObject<UPCGManagedComponent>(SrcComp);
-	ManagedComponent->GeneratedComponent = InComponent;
-	SrcComp->AddToManagedResources(ManagedComponent);
+	InManagedComponent->GeneratedComponent = InComponent;
+	SrcComp->AddToManagedResources(InManagedComponent);
 
 	InParent->Modify(!bIsPreviewMode);
 
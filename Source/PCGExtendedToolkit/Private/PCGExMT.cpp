@@ -7,6 +7,71 @@
 
 namespace PCGExMT
 {
+	FWorkStealingRanges::FWorkStealingRanges(TArray<uint64>&& InScopes, const int32 InNumWorkers, const bool bInPrepareOnly)
+		: Scopes(MoveTemp(InScopes)), bPrepareOnly(bInPrepareOnly)
+	{
+		NumWorkers = FMath::Clamp(InNumWorkers, 1, FMath::Max(1, Scopes.Num()));
+		Queues = MakeUnique<std::atomic<uint64>[]>(NumWorkers);
+
+		// Distribute scopes as evenly as possible, in contiguous slices
+		const int32 NumScopes = Scopes.Num();
+		const int32 PerWorker = NumScopes / NumWorkers;
+		const int32 Remainder = NumScopes % NumWorkers;
+
+		int32 Begin = 0;
+		for (int i = 0; i < NumWorkers; i++)
+		{
+			const int32 End = Begin + PerWorker + (i < Remainder ? 1 : 0);
+			Queues[i].store(PCGEx::H64(Begin, End), std::memory_order_relaxed);
+			Begin = End;
+		}
+
+		ActiveWorkers.store(NumWorkers, std::memory_order_release);
+	}
+
+	bool FWorkStealingRanges::Pop(const int32 WorkerIndex, int32& OutScopeIndex)
+	{
+		std::atomic<uint64>& Queue = Queues[WorkerIndex];
+		uint64 Current = Queue.load(std::memory_order_acquire);
+
+		while (true)
+		{
+			const uint32 Begin = PCGEx::H64A(Current);
+			const uint32 End = PCGEx::H64B(Current);
+			if (Begin >= End) { return false; }
+
+			if (Queue.compare_exchange_weak(Current, PCGEx::H64(Begin + 1, End), std::memory_order_acq_rel))
+			{
+				OutScopeIndex = Begin;
+				return true;
+			}
+		}
+	}
+
+	bool FWorkStealingRanges::Steal(const int32 WorkerIndex, int32& OutScopeIndex)
+	{
+		for (int i = 1; i < NumWorkers; i++)
+		{
+			std::atomic<uint64>& Queue = Queues[(WorkerIndex + i) % NumWorkers];
+			uint64 Current = Queue.load(std::memory_order_acquire);
+
+			while (true)
+			{
+				const uint32 Begin = PCGEx::H64A(Current);
+				const uint32 End = PCGEx::H64B(Current);
+				if (Begin >= End) { break; }
+
+				if (Queue.compare_exchange_weak(Current, PCGEx::H64(Begin, End - 1), std::memory_order_acq_rel))
+				{
+					OutScopeIndex = End - 1;
+					return true;
+				}
+			}
+		}
+
+		return false;
+	}
+
 	FTaskManager::~FTaskManager()
 	{
 		PCGEX_LOG_DTR(FTaskManager)
@@ -131,10 +196,11 @@ namespace PCGExMT
 
 		if (bInlined)
 		{
-			TArray<uint64> Loops;
-			GrowNumStarted(SubRanges(Loops, MaxItems, SanitizedChunkSize));
-			if (OnIterationRangePrepareCallback) { OnIterationRangePrepareCallback(Loops); }
-			InternalStartInlineRange<FGroupRangeInlineIterationTask>(0, MaxItems, SanitizedChunkSize);
+			StartInlineRanges(MaxItems, SanitizedChunkSize, false);
+		}
+		else if (bWorkStealing)
+		{
+			StartStealingRanges(MaxItems, SanitizedChunkSize, false);
 		}
 		else
 		{
@@ -152,11 +218,9 @@ namespace PCGExMT
 
 		if (bInline)
 		{
-			TArray<uint64> Loops;
-			GrowNumStarted(SubRanges(Loops, MaxItems, SanitizedChunkSize));
-			if (OnIterationRangePrepareCallback) { OnIterationRangePrepareCallback(Loops); }
-			InternalStartInlineRange<FGroupPrepareRangeInlineTask>(0, MaxItems, SanitizedChunkSize);
+			StartInlineRanges(MaxItems, SanitizedChunkSize, true);
 		}
+		else if (bWorkStealing) { StartStealingRanges(MaxItems, SanitizedChunkSize, true); }
 		else { StartRanges<FGroupPrepareRangeTask>(MaxItems, SanitizedChunkSize, nullptr); }
 	}
 
@@ -211,6 +275,49 @@ namespace PCGExMT
 		for (int i = 0; i < Count; i++) { OnIterationCallback(StartIndex + i, Count, LoopIdx); }
 	}
 
+	void FTaskGroup::StartInlineRanges(const int32 MaxItems, const int32 ChunkSize, const bool bPrepareOnly)
+	{
+		if (!IsAvailable()) { return; }
+
+		// Scope table is computed once and shared with the task that walks it
+		const TSharedPtr<TArray<uint64>> Loops = MakeShared<TArray<uint64>>();
+		SubRanges(*Loops, MaxItems, ChunkSize);
+
+		GrowNumStarted();
+
+		if (OnIterationRangePrepareCallback) { OnIterationRangePrepareCallback(*Loops); }
+
+		if (bPrepareOnly) { InternalStartInlineRange<FGroupPrepareRangeInlineTask>(Loops); }
+		else { InternalStartInlineRange<FGroupRangeInlineIterationTask>(Loops); }
+	}
+
+	void FTaskGroup::StartStealingRanges(const int32 MaxItems, const int32 ChunkSize, const bool bPrepareOnly)
+	{
+		if (!IsAvailable()) { return; }
+
+		// The whole loop counts as a single unit of work for this group;
+		// workers only report back once the last of them retires.
+		GrowNumStarted();
+
+		TArray<uint64> Loops;
+		SubRanges(Loops, MaxItems, ChunkSize);
+
+		if (OnIterationRangePrepareCallback) { OnIterationRangePrepareCallback(Loops); }
+
+		const int32 NumWorkers = Manager->ForceSync ? 1 : FMath::Max(1, GThreadPool->GetNumThreads());
+		const TSharedPtr<FWorkStealingRanges> Ranges = MakeShared<FWorkStealingRanges>(MoveTemp(Loops), NumWorkers, bPrepareOnly);
+
+		Manager->Reserve(Ranges->NumWorkers);
+
+		const TSharedPtr<FTaskGroup> SharedPtr = SharedThis(this);
+		for (int i = 0; i < Ranges->NumWorkers; i++)
+		{
+			FAsyncTask<FGroupRangeStealingTask>* ATask = new FAsyncTask<FGroupRangeStealingTask>(nullptr, SharedPtr, Ranges);
+			if (Manager->ForceSync) { Manager->StartSynchronousTask<FGroupRangeStealingTask>(ATask, i); }
+			else { Manager->StartBackgroundTask<FGroupRangeStealingTask>(ATask, i); }
+		}
+	}
+
 	void FPCGExTask::DoWork()
 	{
 		if (bWorkDone) { return; }
@@ -258,22 +365,33 @@ namespace PCGExMT
 		return true;
 	}
 
-	bool FGroupPrepareRangeInlineTask::ExecuteTask(const TSharedPtr<FTaskManager>& AsyncManager)
+	bool FGroupRangeStealingTask::ExecuteTask(const TSharedPtr<FTaskManager>& AsyncManager)
 	{
-		if (const TSharedPtr<FTaskGroup> Group = GroupPtr.Pin())
-		{
-			TArray<uint64> Loops;
-			SubRanges(Loops, MaxItems, ChunkSize);
+		const TSharedPtr<FTaskGroup> Group = OwnerGroup.Pin();
+		if (!Group) { return false; }
 
-			uint32 StartIndex;
-			uint32 Count;
-			PCGEx::H64(Loops[TaskIndex], StartIndex, Count);
-
-			Group->PrepareRangeIteration(StartIndex, Count, TaskIndex);
+		int32 ScopeIndex = -1;
+		while (Group->IsAvailable() && (Ranges->Pop(TaskIndex, ScopeIndex) || Ranges->Steal(TaskIndex, ScopeIndex)))
+		{
+			const uint64 Scope = Ranges->Scopes[ScopeIndex];
+			if (Ranges->bPrepareOnly) { Group->PrepareRangeIteration(PCGEx::H64A(Scope), PCGEx::H64B(Scope), ScopeIndex); }
+			else { Group->DoRangeIteration(PCGEx::H64A(Scope), PCGEx::H64B(Scope), ScopeIndex); }
+		}
 
-			if (!Loops.IsValidIndex(TaskIndex + 1)) { return false; }
+		if (Ranges->RetireWorker()) { Group->GrowNumCompleted(); }
+		return true;
+	}
 
-			Group->InternalStartInlineRange<FGroupPrepareRangeInlineTask>(TaskIndex + 1, MaxItems, ChunkSize);
+	bool FGroupPrepareRangeInlineTask::ExecuteTask(const TSharedPtr<FTaskManager>& AsyncManager)
+	{
+		if (const TSharedPtr<FTaskGroup> Group = GroupPtr.Pin())
+		{
+			const TArray<uint64>& Loops = *Scopes;
+			for (int i = 0; i < Loops.Num(); i++)
+			{
+				if (!Group->IsAvailable()) { return false; }
+				Group->PrepareRangeIteration(PCGEx::H64A(Loops[i]), PCGEx::H64B(Loops[i]), i);
+			}
 		}
 		return true;
 	}
@@ -282,18 +400,12 @@ namespace PCGExMT
 	{
 		if (const TSharedPtr<FTaskGroup> Group = GroupPtr.Pin())
 		{
-			TArray<uint64> Loops;
-			SubRanges(Loops, MaxItems, ChunkSize);
-
-			uint32 StartIndex;
-			uint32 Count;
-			PCGEx::H64(Loops[TaskIndex], StartIndex, Count);
-
-			Group->DoRangeIteration(StartIndex, Count, TaskIndex);
-
-			if (!Loops.IsValidIndex(TaskIndex + 1)) { return false; }
-
-			Group->InternalStartInlineRange<FGroupRangeInlineIterationTask>(TaskIndex + 1, MaxItems, ChunkSize);
+			const TArray<uint64>& Loops = *Scopes;
+			for (int i = 0; i < Loops.Num(); i++)
+			{
+				if (!Group->IsAvailable()) { return false; }
+				Group->DoRangeIteration(PCGEx::H64A(Loops[i]), PCGEx::H64B(Loops[i]), i);
+			}
 		}
 		return true;
 	}
@@ -125,29 +125,41 @@ namespace PCGExBlendPath
 		FilterScope(StartIndex, Count);
 	}
 
-	void FProcessor::ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const int32 LoopIdx, const int32 LoopCount)
+	void FProcessor::ProcessPoints(const int32 StartIndex, const int32 Count, const int32 LoopIdx)
 	{
-		if (Index == 0 || Index == MaxIndex) { return; }
+		if (!PointDataFacade->IsDataValid(CurrentProcessingSource)) { return; }
 
-		double Alpha = 0.5;
-		const PCGExData::FPointRef Current = PointDataFacade->Source->GetOutPointRef(Index);
-		MetadataBlender->PrepareForBlending(Current);
+		PrepareSingleLoopScopeForPoints(StartIndex, Count);
 
-		if (Settings->BlendOver == EPCGExBlendOver::Distance)
-		{
-			Alpha = Length[Index] / Metrics.Length;
-		}
-		else if (Settings->BlendOver == EPCGExBlendOver::Index)
-		{
-			Alpha = static_cast<double>(Index) / static_cast<double>(PointDataFacade->GetNum());
-		}
-		else
+		// Every point of the scope blends between the same two endpoints : batch them so each attribute runs over the whole scope at once
+		TArray<PCGExDataBlending::FBlendStep> BlendSteps;
+		BlendSteps.Reserve(Count);
+
+		for (int Index = StartIndex; Index < StartIndex + Count; Index++)
 		{
-			Alpha = LerpCache ? LerpCache->Read(Index) : Settings->LerpConstant;
+			if (Index == 0 || Index == MaxIndex) { continue; }
+
+			double Alpha = 0.5;
+
+			if (Settings->BlendOver == EPCGExBlendOver::Distance)
+			{
+				Alpha = Length[Index] / Metrics.Length;
+			}
+			else if (Settings->BlendOver == EPCGExBlendOver::Index)
+			{
+				Alpha = static_cast<double>(Index) / static_cast<double>(PointDataFacade->GetNum());
+			}
+			else
+			{
+				Alpha = LerpCache ? LerpCache->Read(Index) : Settings->LerpConstant;
+			}
+
+			MetadataBlender->PrepareForBlending(Index);
+			BlendSteps.Emplace(Start->Index, End->Index, Index, Alpha);
 		}
 
-		MetadataBlender->Blend(*Start, *End, Current, Alpha);
-		MetadataBlender->CompleteBlending(Current, 2, 1);
+		MetadataBlender->BlendBatch(BlendSteps);
+		for (const PCGExDataBlending::FBlendStep& Step : BlendSteps) { MetadataBlender->CompleteBlending(Step.WriteIndex, 2, 1); }
 	}
 
 	void FProcessor::CompleteWork()
@@ -64,6 +64,8 @@ bool FPCGExPathSplineMeshElement::Boot(FPCGExContext* InContext) const
 		PCGEX_VALIDATE_NAME(Settings->WeightAttributeName)
 	}
 
+	Context->SplineMeshPool = MakeShared<PCGExPaths::FSplineMeshPool>(Context);
+
 	return true;
 }
 
@@ -94,7 +96,7 @@ bool FPCGExPathSplineMeshElement::PostBoot(FPCGExContext* InContext) const
 
 	PCGEX_CONTEXT(PathSplineMesh)
 
-	Context->MainCollection->LoadCache(); // Make sure to load the stuff
+	Context->MainCollectionCache = Context->MainCollection->RefreshCache(); // Make sure to load the stuff
 	return true;
 }
 
@@ -132,24 +134,35 @@ bool FPCGExPathSplineMeshElement::ExecuteInternal(FPCGContext* InContext) const
 		}
 	}
 
-	PCGEX_POINTS_BATCH_PROCESSING(PCGEx::State_Done)
+	PCGEX_POINTS_BATCH_PROCESSING(PCGEx::State_Writing)
 
-	Context->MainBatch->Output();
+	PCGEX_ON_STATE(PCGEx::State_Writing)
+	{
+		Context->MainBatch->Output();
+		Context->SetState(PCGEx::State_Completing);
+	}
 
-	// Execute PostProcess Functions
-	if (!Context->NotifyActors.IsEmpty())
+	PCGEX_ON_STATE(PCGEx::State_Completing)
 	{
-		TArray<AActor*> NotifyActors = Context->NotifyActors.Array();
-		for (AActor* TargetActor : NotifyActors)
+		// Registration is spread over as many ticks as it takes
+		if (!Context->SplineMeshPool->Drain()) { return false; }
+
+		// Execute PostProcess Functions
+		if (!Context->NotifyActors.IsEmpty())
 		{
-			for (UFunction* Function : PCGExHelpers::FindUserFunctions(TargetActor->GetClass(), Settings->PostProcessFunctionNames, {UPCGExFunctionPrototypes::GetPrototypeWithNoParams()}, Context))
+			TArray<AActor*> NotifyActors = Context->NotifyActors.Array();
+			for (AActor* TargetActor : NotifyActors)
 			{
-				TargetActor->ProcessEvent(Function, nullptr);
+				for (UFunction* Function : PCGExHelpers::FindUserFunctions(TargetActor->GetClass(), Settings->PostProcessFunctionNames, {UPCGExFunctionPrototypes::GetPrototypeWithNoParams()}, Context))
+				{
+					TargetActor->ProcessEvent(Function, nullptr);
+				}
 			}
 		}
-	}
 
-	Context->MainPoints->StageOutputs();
+		Context->MainPoints->StageOutputs();
+		Context->Done();
+	}
 
 	return Context->TryComplete();
 }
@@ -163,10 +176,6 @@ namespace PCGExPathSplineMesh
 
 		if (!FPointsProcessor::Process(InAsyncManager)) { return false; }
 
-#if PCGEX_ENGINE_VERSION > 503
-		bIsPreviewMode = ExecutionContext->SourceComponent.Get()->IsInPreviewMode();
-#endif
-
 		Justification = Settings->Justification;
 		Justification.Init(ExecutionContext, PointDataFacade);
 
@@ -305,7 +314,7 @@ namespace PCGExPathSplineMesh
 
 		if (bOutputWeight)
 		{
-			double Weight = bNormalizedWeight ? static_cast<double>(MeshEntry->Weight) / static_cast<double>(Context->MainCollection->LoadCache()->WeightSum) : MeshEntry->Weight;
+			double Weight = bNormalizedWeight ? static_cast<double>(MeshEntry->Weight) / static_cast<double>(Context->MainCollectionCache->WeightSum) : MeshEntry->Weight;
 			if (bOneMinusWeight) { Weight = 1 - Weight; }
 			if (WeightWriter) { WeightWriter->GetMutable(Index) = Weight; }
 			else if (NormalizedWeightWriter) { NormalizedWeightWriter->GetMutable(Index) = Weight; }
@@ -378,42 +387,43 @@ namespace PCGExPathSplineMesh
 			return;
 		}
 		
+		PCGExPaths::FSplineMeshPool& Pool = *Context->SplineMeshPool;
+		const FName BaseName = Pool.GetBaseName(PointDataFacade->Source->IOIndex);
+
+		uint32 DataTagsHash = 0;
+		if (Settings->TaggingDetails.bForwardInputDataTags) { for (const FName& Tag : DataTags) { DataTagsHash = HashCombineFast(DataTagsHash, GetTypeHash(Tag)); } }
+
 		for (int i = 0; i < Segments.Num(); i++)
 		{
 			const PCGExPaths::FSplineMeshSegment& Segment = Segments[i];
 			if (!Segment.MeshEntry) { continue; }
 
-			const FString ComponentName = TEXT("PCGSplineMeshComponent_") + Segment.MeshEntry->Staging.Path.GetAssetName();
-			const EObjectFlags ObjectFlags = (bIsPreviewMode ? RF_Transient : RF_NoFlags);
-			USplineMeshComponent* SplineMeshComponent = NewObject<USplineMeshComponent>(TargetActor, MakeUniqueObjectName(TargetActor, USplineMeshComponent::StaticClass(), FName(ComponentName)), ObjectFlags);
+			const UStaticMesh* StaticMesh = Segment.MeshEntry->Staging.TryGet<UStaticMesh>();
+			if (!StaticMesh) { continue; }
 
-			SplineMeshComponent->SetCollisionEnabled(ECollisionEnabled::Type::NoCollision);
-			SplineMeshComponent->SetMobility(EComponentMobility::Static);
-			SplineMeshComponent->SetSimulatePhysics(false);
-			SplineMeshComponent->SetMassOverrideInKg(NAME_None, 0.0f);
-			SplineMeshComponent->SetUseCCD(false);
-			SplineMeshComponent->CanCharacterStepUpOn = ECB_No;
-			SplineMeshComponent->bUseDefaultCollision = false;
-			SplineMeshComponent->bNavigationRelevant = false;
-			SplineMeshComponent->SetbNeverNeedsCookedCollisionData(true);
+			const FPCGExStaticMeshComponentDescriptor& Descriptor = Settings->bForceDefaultDescriptor ? Settings->DefaultDescriptor : Segment.MeshEntry->SMDescriptor;
+			const uint64 Hash = Segment.ComputeHash(PCGEx::H64(Pool.GetDescriptorHash(Descriptor), DataTagsHash));
 
-			Segment.ApplySettings(SplineMeshComponent); // Init Component
+			bool bRequiresInit = true;
+			USplineMeshComponent* SplineMeshComponent = Pool.Acquire(TargetActor, FName(BaseName, NAME_EXTERNAL_TO_INTERNAL(i)), Hash, StaticMesh, bRequiresInit);
 
-			if (!Segment.ApplyMesh(SplineMeshComponent))
+			if (bRequiresInit)
 			{
-				SplineMeshComponent->MarkAsGarbage();
-				continue;
-			}
+				Segment.ApplySettings(SplineMeshComponent); // Init Component
 
-			if (Settings->TaggingDetails.bForwardInputDataTags) { SplineMeshComponent->ComponentTags.Append(DataTags); }
-			if (!Segment.Tags.IsEmpty()) { SplineMeshComponent->ComponentTags.Append(Segment.Tags.Array()); }
+				if (!Segment.ApplyMesh(SplineMeshComponent))
+				{
+					Pool.Discard(SplineMeshComponent);
+					continue;
+				}
 
-			if (Settings->bForceDefaultDescriptor) { Settings->DefaultDescriptor.InitComponent(SplineMeshComponent); }
-			else { Segment.MeshEntry->SMDescriptor.InitComponent(SplineMeshComponent); }
+				if (Settings->TaggingDetails.bForwardInputDataTags) { SplineMeshComponent->ComponentTags.Append(DataTags); }
+				if (!Segment.Tags.IsEmpty()) { SplineMeshComponent->ComponentTags.Append(Segment.Tags.Array()); }
 
-			Context->AttachManageComponent(
-				TargetActor, SplineMeshComponent,
-				FAttachmentTransformRules(EAttachmentRule::KeepWorld, EAttachmentRule::KeepWorld, EAttachmentRule::KeepWorld, false));
+				Descriptor.InitComponent(SplineMeshComponent);
+
+				Pool.Commit(SplineMeshComponent, TargetActor, Hash);
+			}
 
 			Context->NotifyActors.Add(TargetActor);
 		}
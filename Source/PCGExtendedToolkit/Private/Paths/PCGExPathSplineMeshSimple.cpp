@@ -29,6 +29,7 @@ bool FPCGExPathSplineMeshSimpleElement::Boot(FPCGExContext* InContext) const
 
 	TArray<FName> Names = {Settings->AssetPathAttributeName};
 	Context->StaticMeshLoader = MakeShared<PCGEx::TAssetLoader<UStaticMesh>>(Context, Context->MainPoints.ToSharedRef(), Names);
+	Context->SplineMeshPool = MakeShared<PCGExPaths::FSplineMeshPool>(Context);
 	return true;
 }
 
@@ -79,24 +80,35 @@ bool FPCGExPathSplineMeshSimpleElement::ExecuteInternal(FPCGContext* InContext)
 		}
 	}
 
-	PCGEX_POINTS_BATCH_PROCESSING(PCGEx::State_Done)
+	PCGEX_POINTS_BATCH_PROCESSING(PCGEx::State_Writing)
 
-	Context->MainBatch->Output();
+	PCGEX_ON_STATE(PCGEx::State_Writing)
+	{
+		Context->MainBatch->Output();
+		Context->SetState(PCGEx::State_Completing);
+	}
 
-	// Execute PostProcess Functions
-	if (!Context->NotifyActors.IsEmpty())
+	PCGEX_ON_STATE(PCGEx::State_Completing)
 	{
-		TArray<AActor*> NotifyActors = Context->NotifyActors.Array();
-		for (AActor* TargetActor : NotifyActors)
+		// Registration is spread over as many ticks as it takes
+		if (!Context->SplineMeshPool->Drain()) { return false; }
+
+		// Execute PostProcess Functions
+		if (!Context->NotifyActors.IsEmpty())
 		{
-			for (UFunction* Function : PCGExHelpers::FindUserFunctions(TargetActor->GetClass(), Settings->PostProcessFunctionNames, {UPCGExFunctionPrototypes::GetPrototypeWithNoParams()}, Context))
+			TArray<AActor*> NotifyActors = Context->NotifyActors.Array();
+			for (AActor* TargetActor : NotifyActors)
 			{
-				TargetActor->ProcessEvent(Function, nullptr);
+				for (UFunction* Function : PCGExHelpers::FindUserFunctions(TargetActor->GetClass(), Settings->PostProcessFunctionNames, {UPCGExFunctionPrototypes::GetPrototypeWithNoParams()}, Context))
+				{
+					TargetActor->ProcessEvent(Function, nullptr);
+				}
 			}
 		}
-	}
 
-	Context->MainPoints->StageOutputs();
+		Context->MainPoints->StageOutputs();
+		Context->Done();
+	}
 
 	return Context->TryComplete();
 }
@@ -260,45 +272,39 @@ namespace PCGExPathSplineMeshSimple
 			return;
 		}
 
-		bool bIsPreviewMode = false;
-#if PCGEX_ENGINE_VERSION > 503
-		bIsPreviewMode = ExecutionContext->SourceComponent.Get()->IsInPreviewMode();
-#endif
+		PCGExPaths::FSplineMeshPool& Pool = *Context->SplineMeshPool;
+		const FName BaseName = Pool.GetBaseName(PointDataFacade->Source->IOIndex);
 
 		TArray<FName> DataTags = PointDataFacade->Source->Tags->ToFNameList();
 
+		uint32 DataTagsHash = 0;
+		if (Settings->TaggingDetails.bForwardInputDataTags) { for (const FName& Tag : DataTags) { DataTagsHash = HashCombineFast(DataTagsHash, GetTypeHash(Tag)); } }
+
+		const uint64 Seed = PCGEx::H64(Pool.GetDescriptorHash(Settings->StaticMeshDescriptor), DataTagsHash);
+
 		for (int i = 0; i < Segments.Num(); i++)
 		{
 			UStaticMesh* Mesh = Meshes[i];
 			if (!Mesh) { continue; }
 
 			const PCGExPaths::FSplineMeshSegment& Segment = Segments[i];
+			const uint64 Hash = Segment.ComputeHash(Seed);
 
-			const FString ComponentName = TEXT("PCGSplineMeshComponent_") + Mesh->GetName();
-			const EObjectFlags ObjectFlags = (bIsPreviewMode ? RF_Transient : RF_NoFlags);
-			USplineMeshComponent* SplineMeshComponent = NewObject<USplineMeshComponent>(TargetActor, MakeUniqueObjectName(TargetActor, USplineMeshComponent::StaticClass(), FName(ComponentName)), ObjectFlags);
+			bool bRequiresInit = true;
+			USplineMeshComponent* SplineMeshComponent = Pool.Acquire(TargetActor, FName(BaseName, NAME_EXTERNAL_TO_INTERNAL(i)), Hash, Mesh, bRequiresInit);
 
-			SplineMeshComponent->SetCollisionEnabled(ECollisionEnabled::Type::NoCollision);
-			SplineMeshComponent->SetMobility(EComponentMobility::Static);
-			SplineMeshComponent->SetSimulatePhysics(false);
-			SplineMeshComponent->SetMassOverrideInKg(NAME_None, 0.0f);
-			SplineMeshComponent->SetUseCCD(false);
-			SplineMeshComponent->CanCharacterStepUpOn = ECB_No;
-			SplineMeshComponent->bUseDefaultCollision = false;
-			SplineMeshComponent->bNavigationRelevant = false;
-			SplineMeshComponent->SetbNeverNeedsCookedCollisionData(true);
-
-			Segment.ApplySettings(SplineMeshComponent);    // Init Component
-			SplineMeshComponent->SetStaticMesh(Mesh); // Will trigger a force rebuild, so put this last
+			if (bRequiresInit)
+			{
+				Segment.ApplySettings(SplineMeshComponent);    // Init Component
+				SplineMeshComponent->SetStaticMesh(Mesh); // Will trigger a force rebuild, so put this last
 
-			if (Settings->TaggingDetails.bForwardInputDataTags) { SplineMeshComponent->ComponentTags.Append(DataTags); }
-			if (!Segment.Tags.IsEmpty()) { SplineMeshComponent->ComponentTags.Append(Segment.Tags.Array()); }
+				if (Settings->TaggingDetails.bForwardInputDataTags) { SplineMeshComponent->ComponentTags.Append(DataTags); }
+				if (!Segment.Tags.IsEmpty()) { SplineMeshComponent->ComponentTags.Append(Segment.Tags.Array()); }
 
-			Settings->StaticMeshDescriptor.InitComponent(SplineMeshComponent);
+				Settings->StaticMeshDescriptor.InitComponent(SplineMeshComponent);
 
-			Context->AttachManageComponent(
-				TargetActor, SplineMeshComponent,
-				FAttachmentTransformRules(EAttachmentRule::KeepWorld, EAttachmentRule::KeepWorld, EAttachmentRule::KeepWorld, false));
+				Pool.Commit(SplineMeshComponent, TargetActor, Hash);
+			}
 
 			Context->NotifyActors.Add(TargetActor);
 		}
@@ -0,0 +1,154 @@
+﻿// Copyright Timothé Lapetite 2024
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Paths/PCGExSplineMeshPool.h"
+
+#include "PCGComponent.h"
+#include "PCGExContext.h"
+#include "PCGExGlobalSettings.h"
+#include "Collections/PCGExComponentDescriptors.h"
+#include "Helpers/PCGHelpers.h"
+
+namespace PCGExPaths
+{
+	FSplineMeshPool::FSplineMeshPool(FPCGExContext* InContext)
+		: Context(InContext)
+	{
+		UPCGComponent* SrcComp = Context->SourceComponent.Get();
+		check(SrcComp)
+
+		PoolKey = HashCombineFast(GetTypeHash(SrcComp->GetName()), GetTypeHash(Context->GetInputSettings<UPCGSettings>()->GetPathName()));
+
+#if PCGEX_ENGINE_VERSION > 503
+		bTransient = SrcComp->IsInPreviewMode();
+#endif
+
+		if (!GetDefault<UPCGExGlobalSettings>()->bReuseSplineMeshComponents) { return; }
+
+		SrcComp->ForEachManagedResource(
+			[&](UPCGManagedResource* InResource)
+			{
+				UPCGExManagedSplineMeshComponent* Resource = Cast<UPCGExManagedSplineMeshComponent>(InResource);
+				if (!Resource || Resource->PoolKey != PoolKey || !Resource->IsMarkedUnused()) { return; }
+
+				const USplineMeshComponent* Component = Resource->GetComponent();
+				if (!IsValid(Component) || Component->HasAnyFlags(RF_Transient) != bTransient) { return; }
+
+				Available.Add(Component->GetFName(), Resource);
+			});
+	}
+
+	FName FSplineMeshPool::GetBaseName(const int32 InIOIndex) const
+	{
+		return FName(FString::Printf(TEXT("PCGExSplineMesh_%08X_%d"), PoolKey, InIOIndex));
+	}
+
+	uint32 FSplineMeshPool::GetDescriptorHash(const FPCGExStaticMeshComponentDescriptor& InDescriptor)
+	{
+		if (const uint32* Hash = DescriptorHashes.Find(&InDescriptor)) { return *Hash; }
+
+		FString Values;
+		FPCGExStaticMeshComponentDescriptor::StaticStruct()->ExportText(Values, &InDescriptor, nullptr, nullptr, PPF_None, nullptr);
+
+		return DescriptorHashes.Add(&InDescriptor, GetTypeHash(Values));
+	}
+
+	USplineMeshComponent* FSplineMeshPool::Acquire(AActor* InOwner, const FName InName, const uint64 InHash, const UStaticMesh* InMesh, bool& bOutRequiresInit)
+	{
+		bOutRequiresInit = true;
+
+		TObjectPtr<UPCGExManagedSplineMeshComponent> Resource;
+		if (Available.RemoveAndCopyValue(InName, Resource) && Resource->IsMarkedUnused())
+		{
+			USplineMeshComponent* Component = Resource->GetComponent();
+			if (IsValid(Component) && Component->GetOwner() == InOwner)
+			{
+				// New components are attached keeping an identity world transform; the owner may have moved since
+				Component->SetWorldTransform(FTransform::Identity);
+
+				const UStaticMesh* CurrentMesh = Component->GetStaticMesh();
+				if (Resource->SegmentHash == InHash && CurrentMesh == InMesh)
+				{
+					// Untouched since last time
+					Resource->MarkAsUsed();
+					bOutRequiresInit = false;
+					return Component;
+				}
+
+				// Reinitialized in place, tags included
+				Component->ComponentTags.Reset();
+				Claimed.Add(Component, Resource);
+				return Component;
+			}
+		}
+
+		// Only fall back to a unique name if the deterministic one is taken, either by another execution or by something pending destruction
+		const FName Name = StaticFindObjectFast(nullptr, InOwner, InName) ? MakeUniqueObjectName(InOwner, USplineMeshComponent::StaticClass(), InName) : InName;
+		USplineMeshComponent* Component = NewObject<USplineMeshComponent>(InOwner, Name, bTransient ? RF_Transient : RF_NoFlags);
+
+		// Keep it alive until it's registered
+		Context->ManagedObjects->Add(Component);
+
+		Component->SetCollisionEnabled(ECollisionEnabled::Type::NoCollision);
+		Component->SetMobility(EComponentMobility::Static);
+		Component->SetSimulatePhysics(false);
+		Component->SetMassOverrideInKg(NAME_None, 0.0f);
+		Component->SetUseCCD(false);
+		Component->CanCharacterStepUpOn = ECB_No;
+		Component->bUseDefaultCollision = false;
+		Component->bNavigationRelevant = false;
+		Component->SetbNeverNeedsCookedCollisionData(true);
+
+		return Component;
+	}
+
+	void FSplineMeshPool::Commit(USplineMeshComponent* InComponent, AActor* InOwner, const uint64 InHash)
+	{
+		TObjectPtr<UPCGExManagedSplineMeshComponent> Resource;
+		if (Claimed.RemoveAndCopyValue(InComponent, Resource)) { Resource->MarkAsUsed(); }
+
+		Pending.Add(FPending{InComponent, InOwner, Resource, InHash});
+	}
+
+	void FSplineMeshPool::Discard(USplineMeshComponent* InComponent)
+	{
+		// Reused components are simply left unused, PCG will clean them up
+		if (Claimed.Remove(InComponent)) { return; }
+		Context->ManagedObjects->Destroy(InComponent);
+	}
+
+	bool FSplineMeshPool::Drain()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExPaths::FSplineMeshPool::Drain);
+
+		UPCGComponent* SrcComp = Context->SourceComponent.Get();
+		const double Budget = GetDefault<UPCGExGlobalSettings>()->ComponentRegistrationBudgetMs * 0.001;
+		const double EndTime = FPlatformTime::Seconds() + Budget;
+
+		const FAttachmentTransformRules AttachmentRules(EAttachmentRule::KeepWorld, EAttachmentRule::KeepWorld, EAttachmentRule::KeepWorld, false);
+
+		while (DrainIndex < Pending.Num())
+		{
+			const FPending& Item = Pending[DrainIndex++];
+
+			if (Item.Resource)
+			{
+				Item.Component->ComponentTags.Add(SrcComp->GetFName());
+				Item.Component->ComponentTags.Add(PCGHelpers::DefaultPCGTag);
+				Item.Component->UpdateRenderStateAndCollision();
+				Item.Resource->SegmentHash = Item.Hash;
+			}
+			else
+			{
+				UPCGExManagedSplineMeshComponent* Resource = NewObject<UPCGExManagedSplineMeshComponent>(SrcComp);
+				Resource->PoolKey = PoolKey;
+				Resource->SegmentHash = Item.Hash;
+				Context->AttachManageComponent(Item.Owner, Item.Component, Resource, AttachmentRules);
+			}
+
+			if (Budget > 0 && FPlatformTime::Seconds() >= EndTime) { break; }
+		}
+
+		return DrainIndex >= Pending.Num();
+	}
+}
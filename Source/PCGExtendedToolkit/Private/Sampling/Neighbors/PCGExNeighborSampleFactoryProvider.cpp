@@ -17,6 +17,7 @@ void UPCGExNeighborSampleOperation::CopySettingsFrom(const UPCGExOperation* Othe
 	{
 		SamplingConfig = TypedOther->SamplingConfig;
 		WeightCurveObj = TypedOther->WeightCurveObj;
+		WeightLUT = TypedOther->WeightLUT;
 	}
 }
 
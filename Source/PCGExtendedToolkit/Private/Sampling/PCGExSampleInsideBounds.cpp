@@ -60,6 +60,8 @@ bool FPCGExSampleInsideBoundsElement::Boot(FPCGExContext* InContext) const
 		return false;
 	}
 
+	Context->WeightLUT = MakeShared<PCGEx::FCurveLUT>(Context->WeightCurve);
+
 	Context->TargetPoints = &Context->TargetsFacade->Source->GetIn()->GetPoints();
 	Context->NumTargets = Context->TargetPoints->Num();
 
@@ -247,6 +249,8 @@ namespace PCGExSampleInsideBoundss
 		double TotalWeight = 0;
 		double TotalSamples = 0;
 
+		TArray<PCGExDataBlending::FBlendStep, TInlineAllocator<16>> BlendSteps;
+
 		auto ProcessTargetInfos = [&]
 			(const PCGExInsideBounds::FTargetInfos& TargetInfos, const double Weight)
 		{
@@ -267,7 +271,7 @@ namespace PCGExSampleInsideBoundss
 			TotalWeight += Weight;
 			TotalSamples++;
 
-			if (Blender) { Blender->Blend(Index, TargetInfos.Index, Index, Weight); }
+			if (Blender) { BlendSteps.Emplace(Index, TargetInfos.Index, Index, Weight); }
 		};
 
 		if (Blender) { Blender->PrepareForBlending(Index, &Point); }
@@ -275,20 +279,24 @@ namespace PCGExSampleInsideBoundss
 		if (bSingleSample)
 		{
 			const PCGExInsideBounds::FTargetInfos& TargetInfos = Settings->SampleMethod == EPCGExSampleMethod::ClosestTarget ? TargetsCompoundInfos.Closest : TargetsCompoundInfos.Farthest;
-			const double Weight = Context->WeightCurve->GetFloatValue(TargetsCompoundInfos.GetRangeRatio(TargetInfos.Distance));
+			const double Weight = Context->WeightLUT->Eval(TargetsCompoundInfos.GetRangeRatio(TargetInfos.Distance));
 			ProcessTargetInfos(TargetInfos, Weight);
 		}
 		else
 		{
 			for (PCGExInsideBounds::FTargetInfos& TargetInfos : TargetsInfos)
 			{
-				const double Weight = Context->WeightCurve->GetFloatValue(TargetsCompoundInfos.GetRangeRatio(TargetInfos.Distance));
+				const double Weight = Context->WeightLUT->Eval(TargetsCompoundInfos.GetRangeRatio(TargetInfos.Distance));
 				if (Weight == 0) { continue; }
 				ProcessTargetInfos(TargetInfos, Weight);
 			}
 		}
 
-		if (Blender) { Blender->CompleteBlending(Index, TotalSamples, TotalWeight); }
+		if (Blender)
+		{
+			Blender->BlendBatch(BlendSteps);
+			Blender->CompleteBlending(Index, TotalSamples, TotalWeight);
+		}
 
 		if (TotalWeight != 0) // Dodge NaN
 		{
@@ -60,6 +60,8 @@ bool FPCGExSampleNearestBoundsElement::Boot(FPCGExContext* InContext) const
 		return false;
 	}
 
+	Context->WeightLUT = MakeShared<PCGEx::FCurveLUT>(Context->WeightCurve);
+
 	Context->BoundsPoints = &Context->BoundsFacade->Source->GetIn()->GetPoints();
 
 	return true;
@@ -167,7 +169,7 @@ namespace PCGExSampleNearestBounds
 			BCAE, [&](const PCGExGeo::FPointBox* NearbyBox)
 			{
 				NearbyBox->Sample(Point, CurrentSample);
-				CurrentSample.Weight = Context->WeightCurve->GetFloatValue(CurrentSample.Weight);
+				CurrentSample.Weight = Context->WeightLUT->Eval(CurrentSample.Weight);
 
 				if (!CurrentSample.bIsInside) { return; }
 
@@ -199,6 +201,8 @@ namespace PCGExSampleNearestBounds
 		double TotalWeight = 0;
 		double TotalSamples = 0;
 
+		TArray<PCGExDataBlending::FBlendStep, TInlineAllocator<16>> BlendSteps;
+
 		auto ProcessTargetInfos = [&]
 			(const PCGExNearestBounds::FTargetInfos& TargetInfos)
 		{
@@ -220,7 +224,7 @@ namespace PCGExSampleNearestBounds
 			TotalWeight += Weight;
 			TotalSamples++;
 
-			if (Blender) { Blender->Blend(Index, TargetInfos.Index, Index, Weight); }
+			if (Blender) { BlendSteps.Emplace(Index, TargetInfos.Index, Index, Weight); }
 		};
 
 		if (Blender) { Blender->PrepareForBlending(Index, &Point); }
@@ -256,7 +260,11 @@ namespace PCGExSampleNearestBounds
 			}
 		}
 
-		if (Blender) { Blender->CompleteBlending(Index, TotalSamples, TotalWeight); }
+		if (Blender)
+		{
+			Blender->BlendBatch(BlendSteps);
+			Blender->CompleteBlending(Index, TotalSamples, TotalWeight);
+		}
 
 		if (TotalWeight != 0) // Dodge NaN
 		{
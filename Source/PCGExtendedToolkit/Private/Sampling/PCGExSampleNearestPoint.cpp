@@ -60,11 +60,23 @@ bool FPCGExSampleNearestPointElement::Boot(FPCGExContext* InContext) const
 		return false;
 	}
 
+	Context->WeightLUT = MakeShared<PCGEx::FCurveLUT>(Context->WeightCurve);
+
 	Context->TargetPoints = &Context->TargetsFacade->Source->GetIn()->GetPoints();
 	Context->NumTargets = Context->TargetPoints->Num();
 
 	Context->TargetOctree = &Context->TargetsFacade->Source->GetIn()->GetOctree();
 
+	// Unbounded single samples on plain center distances don't need to look at every target
+	if (Settings->SampleMethod != EPCGExSampleMethod::WithinRange &&
+		Settings->WeightMode == EPCGExSampleWeightMode::Distance &&
+		Settings->DistanceDetails.Source == EPCGExDistance::Center &&
+		Settings->DistanceDetails.Target == EPCGExDistance::Center &&
+		(Settings->bUseLocalRangeMax || Settings->RangeMax <= 0))
+	{
+		Context->TargetsTree = MakeShared<PCGExGeo::FPointKDTree>(*Context->TargetPoints);
+	}
+
 	if (Settings->WeightMode != EPCGExSampleWeightMode::Distance)
 	{
 		Context->TargetWeights = Context->TargetsFacade->GetBroadcaster<double>(Settings->WeightAttribute);
@@ -188,6 +200,8 @@ namespace PCGExSampleNearestPoints
 		TArray<PCGExNearestPoint::FTargetInfos> TargetsInfos;
 		//TargetsInfos.Reserve(Context->Targets->GetNum());
 
+		bool bTreeSample = false;
+
 
 		PCGExNearestPoint::FTargetsCompoundInfos TargetsCompoundInfos;
 		auto SampleTarget = [&](const int32 TargetPtIndex, const FPCGPoint& Target)
@@ -228,9 +242,22 @@ namespace PCGExSampleNearestPoints
 
 			Context->TargetOctree->FindElementsWithBoundsTest(Box, ProcessNeighbor);
 		}
+		else if (Context->TargetsTree)
+		{
+			double Dist;
+			const int32 TargetPtIndex = Settings->SampleMethod == EPCGExSampleMethod::ClosestTarget ?
+				                            Context->TargetsTree->FindNearest(SourceCenter, Dist) :
+				                            Context->TargetsTree->FindFarthest(SourceCenter, Dist);
+
+			if (TargetPtIndex != -1)
+			{
+				bTreeSample = true;
+				SampleTarget(TargetPtIndex, *(Context->TargetPoints->GetData() + TargetPtIndex));
+			}
+		}
 		else
 		{
-			TargetsInfos.Reserve(Context->NumTargets);
+			if (!bSingleSample) { TargetsInfos.Reserve(Context->NumTargets); }
 			for (int i = 0; i < Context->NumTargets; i++) { SampleTarget(i, *(Context->TargetPoints->GetData() + i)); }
 		}
 
@@ -260,6 +287,8 @@ namespace PCGExSampleNearestPoints
 		double TotalWeight = 0;
 		double TotalSamples = 0;
 
+		TArray<PCGExDataBlending::FBlendStep, TInlineAllocator<16>> BlendSteps;
+
 		auto ProcessTargetInfos = [&]
 			(const PCGExNearestPoint::FTargetInfos& TargetInfos, const double Weight)
 		{
@@ -280,7 +309,7 @@ namespace PCGExSampleNearestPoints
 			TotalWeight += Weight;
 			TotalSamples++;
 
-			if (Blender) { Blender->Blend(Index, TargetInfos.Index, Index, Weight); }
+			if (Blender) { BlendSteps.Emplace(Index, TargetInfos.Index, Index, Weight); }
 		};
 
 		if (Blender) { Blender->PrepareForBlending(Index, &Point); }
@@ -288,20 +317,36 @@ namespace PCGExSampleNearestPoints
 		if (bSingleSample)
 		{
 			const PCGExNearestPoint::FTargetInfos& TargetInfos = Settings->SampleMethod == EPCGExSampleMethod::ClosestTarget ? TargetsCompoundInfos.Closest : TargetsCompoundInfos.Farthest;
-			const double Weight = Context->WeightCurve->GetFloatValue(TargetsCompoundInfos.GetRangeRatio(TargetInfos.Distance));
+
+			double Ratio = 0;
+			if (bTreeSample)
+			{
+				// A tree sample only knows about its single hit; it sits at the very start (or end) of the full range
+				Ratio = Settings->SampleMethod == EPCGExSampleMethod::ClosestTarget ? 0 : 1;
+			}
+			else
+			{
+				Ratio = TargetsCompoundInfos.GetRangeRatio(TargetInfos.Distance);
+			}
+
+			const double Weight = Context->WeightLUT->Eval(Ratio);
 			ProcessTargetInfos(TargetInfos, Weight);
 		}
 		else
 		{
 			for (PCGExNearestPoint::FTargetInfos& TargetInfos : TargetsInfos)
 			{
-				const double Weight = Context->WeightCurve->GetFloatValue(TargetsCompoundInfos.GetRangeRatio(TargetInfos.Distance));
+				const double Weight = Context->WeightLUT->Eval(TargetsCompoundInfos.GetRangeRatio(TargetInfos.Distance));
 				if (Weight == 0) { continue; }
 				ProcessTargetInfos(TargetInfos, Weight);
 			}
 		}
 
-		if (Blender) { Blender->CompleteBlending(Index, TotalSamples, TotalWeight); }
+		if (Blender)
+		{
+			Blender->BlendBatch(BlendSteps);
+			Blender->CompleteBlending(Index, TotalSamples, TotalWeight);
+		}
 
 		if (TotalWeight != 0) // Dodge NaN
 		{
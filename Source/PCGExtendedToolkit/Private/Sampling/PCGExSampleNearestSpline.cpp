@@ -72,6 +72,8 @@ bool FPCGExSampleNearestSplineElement::Boot(FPCGExContext* InContext) const
 	Context->SegmentCounts.SetNumUninitialized(Context->NumTargets);
 	for (int i = 0; i < Context->NumTargets; i++) { Context->SegmentCounts[i] = Context->Targets[i]->SplineStruct.GetNumberOfSplineSegments(); }
 
+	Context->SplineBVH = MakeShared<PCGExGeo::FSplineBVH>(Context->Splines);
+
 	Context->WeightCurve = Settings->WeightOverDistance.LoadSynchronous();
 	if (!Context->WeightCurve)
 	{
@@ -79,6 +81,8 @@ bool FPCGExSampleNearestSplineElement::Boot(FPCGExContext* InContext) const
 		return false;
 	}
 
+	Context->WeightLUT = MakeShared<PCGEx::FCurveLUT>(Context->WeightCurve);
+
 	PCGEX_FOREACH_FIELD_NEARESTPOLYLINE(PCGEX_OUTPUT_VALIDATE_NAME)
 
 	return true;
@@ -265,28 +269,39 @@ namespace PCGExSampleNearestSpline
 			TargetsCompoundInfos.UpdateCompound(Infos, IsNewClosest, IsNewFarthest);
 		};
 
+		auto SampleTarget = [&](const int32 TargetIndex, const double Time)
+		{
+			const FPCGSplineStruct& Line = Context->Splines[TargetIndex];
+			const FTransform SampledTransform = Line.GetTransformAtSplineInputKey(static_cast<float>(Time), ESplineCoordinateSpace::World, false);
+			ProcessTarget(SampledTransform, Time / Context->SegmentCounts[TargetIndex], Line);
+		};
+
 		// First: Sample all possible targets
 		if (RangeMax > 0)
 		{
-			for (int i = 0; i < Context->NumTargets; i++)
+			// Distances are measured from the spatialized center, which can sit anywhere within the point's bounds
+			double Reach = FMath::Sqrt(RangeMax);
+			if (Settings->DistanceSettings != EPCGExDistance::Center)
 			{
-				const FPCGSplineStruct& Line = Context->Splines[i];
-				FTransform SampledTransform;
-				double Time = Line.FindInputKeyClosestToWorldLocation(Origin);
-				SampledTransform = Line.GetTransformAtSplineInputKey(static_cast<float>(Time), ESplineCoordinateSpace::World, false);
-				ProcessTarget(SampledTransform, Time / Context->SegmentCounts[i], Line);
+				Reach += (FVector::Max(Point.BoundsMin.GetAbs(), Point.BoundsMax.GetAbs()) * Point.Transform.GetScale3D().GetAbs()).Length();
 			}
+
+			Context->SplineBVH->ForEachSplineWithin(
+				Origin, Reach * Reach, [&](const int32 TargetIndex)
+				{
+					SampleTarget(TargetIndex, Context->SplineBVH->FindClosestKey(TargetIndex, Origin));
+				});
+		}
+		else if (Settings->SampleMethod == EPCGExSampleMethod::ClosestTarget && Settings->DistanceSettings == EPCGExDistance::Center)
+		{
+			// Unbounded & only the closest matters : let the index find it
+			double Time = 0;
+			const int32 TargetIndex = Context->SplineBVH->FindNearestSpline(Origin, Time);
+			if (TargetIndex != -1) { SampleTarget(TargetIndex, Time); }
 		}
 		else
 		{
-			for (int i = 0; i < Context->NumTargets; i++)
-			{
-				const FPCGSplineStruct& Line = Context->Splines[i];
-				FTransform SampledTransform;
-				double Time = Line.FindInputKeyClosestToWorldLocation(Origin);
-				SampledTransform = Line.GetTransformAtSplineInputKey(static_cast<float>(Time), ESplineCoordinateSpace::World, false);
-				ProcessTarget(SampledTransform, Time / Context->SegmentCounts[i], Line);
-			}
+			for (int i = 0; i < Context->NumTargets; i++) { SampleTarget(i, Context->SplineBVH->FindClosestKey(i, Origin)); }
 		}
 
 		// Compound never got updated, meaning we couldn't find target in range
@@ -339,14 +354,14 @@ namespace PCGExSampleNearestSpline
 			Settings->SampleMethod == EPCGExSampleMethod::FarthestTarget)
 		{
 			const PCGExPolyLine::FSampleInfos& TargetInfos = Settings->SampleMethod == EPCGExSampleMethod::ClosestTarget ? TargetsCompoundInfos.Closest : TargetsCompoundInfos.Farthest;
-			const double Weight = Context->WeightCurve->GetFloatValue(TargetsCompoundInfos.GetRangeRatio(TargetInfos.Distance));
+			const double Weight = Context->WeightLUT->Eval(TargetsCompoundInfos.GetRangeRatio(TargetInfos.Distance));
 			ProcessTargetInfos(TargetInfos, Weight);
 		}
 		else
 		{
 			for (PCGExPolyLine::FSampleInfos& TargetInfos : TargetsInfos)
 			{
-				const double Weight = Context->WeightCurve->GetFloatValue(TargetsCompoundInfos.GetRangeRatio(TargetInfos.Distance));
+				const double Weight = Context->WeightLUT->Eval(TargetsCompoundInfos.GetRangeRatio(TargetInfos.Distance));
 				if (Weight == 0) { continue; }
 				ProcessTargetInfos(TargetInfos, Weight);
 			}
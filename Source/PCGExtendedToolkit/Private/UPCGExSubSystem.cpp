@@ -1,13 +1,65 @@
 ﻿#include "UPCGExSubSystem.h"
 
+#include "PCGExGlobalSettings.h"
+#include "PCGModule.h"
+
 void UPCGExSubSystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
-	// Initialization code
+	GetClusterCache();
 }
 
 void UPCGExSubSystem::Deinitialize()
 {
+	FWriteScopeLock WriteScopeLock(ClusterCacheLock);
+
+	if (ClusterCache)
+	{
+		const PCGExClusterCache::FStats Stats = ClusterCache->GetStats();
+		UE_LOG(
+			LogPCG, Verbose, TEXT("PCGEx cluster cache : %lld hits, %lld misses, %lld evictions, %d entries (%lld / %lld bytes)"),
+			Stats.Hits, Stats.Misses, Stats.Evictions, Stats.NumEntries, Stats.UsedBytes, Stats.BudgetBytes);
+
+		ClusterCache->Empty();
+		ClusterCache.Reset();
+	}
+
 	Super::Deinitialize();
-	// Cleanup code
+}
+
+TSharedPtr<PCGExClusterCache::FCache> UPCGExSubSystem::GetClusterCache()
+{
+	// Settings are checked on every request, so toggling the cache or changing its budget doesn't require a restart
+	const UPCGExGlobalSettings* GlobalSettings = GetDefault<UPCGExGlobalSettings>();
+	const bool bEnabled = GlobalSettings->bPersistentClusterCache;
+	const int64 BudgetBytes = static_cast<int64>(GlobalSettings->PersistentClusterCacheBudgetMB) * 1024 * 1024;
+
+	{
+		FReadScopeLock ReadScopeLock(ClusterCacheLock);
+		if (ClusterCache.IsValid() == bEnabled && (!bEnabled || ClusterCacheBudgetBytes == BudgetBytes)) { return ClusterCache; }
+	}
+
+	FWriteScopeLock WriteScopeLock(ClusterCacheLock);
+
+	if (!bEnabled)
+	{
+		if (ClusterCache)
+		{
+			ClusterCache->Empty();
+			ClusterCache.Reset();
+		}
+		return nullptr;
+	}
+
+	if (!ClusterCache) { ClusterCache = MakeShared<PCGExClusterCache::FCache>(BudgetBytes); }
+	else if (ClusterCacheBudgetBytes != BudgetBytes) { ClusterCache->SetBudget(BudgetBytes); }
+
+	ClusterCacheBudgetBytes = BudgetBytes;
+	return ClusterCache;
+}
+
+PCGExClusterCache::FStats UPCGExSubSystem::GetClusterCacheStats() const
+{
+	FReadScopeLock ReadScopeLock(ClusterCacheLock);
+	return ClusterCache ? ClusterCache->GetStats() : PCGExClusterCache::FStats();
 }
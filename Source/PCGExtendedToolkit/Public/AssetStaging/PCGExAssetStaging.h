@@ -88,6 +88,7 @@ struct /*PCGEXTENDEDTOOLKIT_API*/ FPCGExAssetStagingContext final : FPCGExPoints
 	virtual void RegisterAssetDependencies() override;
 
 	TObjectPtr<UPCGExAssetCollection> MainCollection;
+	const PCGExAssetCollection::FCache* MainCollectionCache = nullptr;
 };
 
 class /*PCGEXTENDEDTOOLKIT_API*/ FPCGExAssetStagingElement final : public FPCGExPointsProcessorElement
@@ -331,6 +331,28 @@ namespace PCGExAssetCollection
 		RecursiveCollectionsOnly,
 	};
 
+	/**
+	 * Vose alias table : weighted picks in constant time, regardless of the number of items.
+	 * Each column holds an item, its odds against its alias, and the alias; a pick is one column roll and one coin flip.
+	 */
+	struct /*PCGEXTENDEDTOOLKIT_API*/ FAliasTable
+	{
+		TArray<double> Probabilities;
+		TArray<int32> Aliases;
+
+		/** Items with a weight of zero or less are never picked. If no item has a positive weight, picks are uniform. */
+		void Build(const TArray<double>& InWeights);
+
+		FORCEINLINE bool IsEmpty() const { return Probabilities.IsEmpty(); }
+
+		FORCEINLINE int32 Pick(const int32 Seed) const
+		{
+			FRandomStream RandomStream(Seed);
+			const int32 Column = RandomStream.RandHelper(Probabilities.Num());
+			return RandomStream.GetFraction() < Probabilities[Column] ? Column : Aliases[Column];
+		}
+	};
+
 	struct /*PCGEXTENDEDTOOLKIT_API*/ FCategory
 	{
 		FName Name = NAME_None;
@@ -339,6 +361,7 @@ namespace PCGExAssetCollection
 		TArray<int32> Weights;
 		TArray<int32> Order;
 		TArray<const FPCGExAssetCollectionEntry*> Entries;
+		FAliasTable WeightedPicks;
 
 		FCategory()
 		{
@@ -394,10 +417,7 @@ namespace PCGExAssetCollection
 
 		FORCEINLINE int32 GetPickRandomWeighted(const int32 Seed) const
 		{
-			const double Threshold = FRandomStream(Seed).RandRange(0, WeightSum - 1);
-			int32 Pick = 0;
-			while (Pick < Weights.Num() && Weights[Pick] <= Threshold) { Pick++; }
-			return Indices[Order[Pick]];
+			return Indices[WeightedPicks.Pick(Seed)];
 		}
 
 
@@ -425,6 +445,21 @@ namespace PCGExAssetCollection
 		TSharedPtr<FCategory> Main;
 		TMap<FName, TSharedPtr<FCategory>> Categories;
 
+		struct FFlatDependency
+		{
+			TWeakObjectPtr<const UPCGExAssetCollection> Collection;
+			uint32 Version = 0;
+		};
+
+		// Leaf entries of the main category, with nested sub-collections resolved, and their overall odds
+		TArray<const FPCGExAssetCollectionEntry*> FlatEntries;
+		TArray<double> FlatWeights;
+		FAliasTable FlatPicks;
+
+		// Every collection resolved into the flattened picks, nested ones included, and its version at the time
+		TArray<FFlatDependency> FlatDependencies;
+		bool bResolving = true; // Until flattened picks are first built; a collection nested in itself is skipped while resolving
+
 		explicit FCache()
 		{
 			Main = MakeShared<FCategory>(NAME_None);
@@ -437,6 +472,21 @@ namespace PCGExAssetCollection
 		void Compile();
 
 		void RegisterEntry(const int32 Index, const FPCGExAssetCollectionEntry* InEntry);
+
+		/**
+		 * Weighted random leaf entry, sub-collections included, in a single pick.
+		 * Returns nullptr if there's nothing to pick.
+		 */
+		FORCEINLINE const FPCGExAssetCollectionEntry* GetPickFlatWeighted(const int32 Seed) const
+		{
+			if (FlatPicks.IsEmpty()) { return nullptr; }
+			return FlatEntries[FlatPicks.Pick(Seed)];
+		}
+
+		/** Whether a collection resolved into the flattened picks has changed or is gone since they were built. */
+		bool IsFlatPicksStale() const;
+
+		void BuildFlatPicks();
 	};
 
 #pragma region Staging bounds update
@@ -481,6 +531,10 @@ class /*PCGEXTENDEDTOOLKIT_API*/ UPCGExAssetCollection : public UDataAsset
 public:
 	PCGExAssetCollection::FCache* LoadCache();
 
+	/** Same as LoadCache, but also rebuilds flattened picks that went stale. Not thread-safe : call once, on the game thread, before workers read the cache. */
+	PCGExAssetCollection::FCache* RefreshCache();
+	uint32 GetCacheVersion() const { return CacheVersion; }
+
 	virtual void PostLoad() override;
 	virtual void PostDuplicate(bool bDuplicateForPIE) override;
 	virtual void PostEditImport() override;
@@ -607,9 +661,11 @@ protected:
 		const T*& OutEntry,
 		const TArray<T>& InEntries, const int32 Seed) const
 	{
-		const T& Entry = InEntries[Cache->Main->GetPickRandomWeighted(Seed)];
-		if (Entry.SubCollectionPtr) { Entry.SubCollectionPtr->GetEntryWeightedRandomTpl(OutEntry, Entry.SubCollectionPtr->Entries, Seed + 1); }
-		else { OutEntry = &Entry; }
+		// Flattened entries come from collections of the same type as this one
+		const FPCGExAssetCollectionEntry* FlatEntry = Cache->GetPickFlatWeighted(Seed);
+		if (!FlatEntry) { return false; }
+
+		OutEntry = static_cast<const T*>(FlatEntry);
 		return true;
 	}
 
@@ -704,6 +760,8 @@ protected:
 	UPROPERTY()
 	bool bCacheNeedsRebuild = true;
 
+	uint32 CacheVersion = 0; // Bumped whenever entries change, so parents know to flatten them again
+
 	TUniquePtr<PCGExAssetCollection::FCache> Cache;
 
 	template <typename T>
@@ -735,6 +793,7 @@ protected:
 	void EDITOR_SetDirty()
 	{
 		bCacheNeedsRebuild = true;
+		++CacheVersion;
 	}
 #endif
 
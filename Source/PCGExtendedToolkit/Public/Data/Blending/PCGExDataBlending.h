@@ -318,6 +318,33 @@ struct /*PCGEXTENDEDTOOLKIT_API*/ FPCGExBlendingDetails
 
 namespace PCGExDataBlending
 {
+	/** A single blend of a batch : WriteIndex = Primary blended with Secondary. */
+	struct /*PCGEXTENDEDTOOLKIT_API*/ FBlendStep
+	{
+		int32 PrimaryIndex = -1;
+		int32 SecondaryIndex = -1;
+		int32 WriteIndex = -1;
+		double Weight = 0;
+		bool bFirstOperation = false;
+
+		FBlendStep()
+		{
+		}
+
+		FBlendStep(const int32 InPrimaryIndex, const int32 InSecondaryIndex, const int32 InWriteIndex, const double InWeight)
+			: PrimaryIndex(InPrimaryIndex), SecondaryIndex(InSecondaryIndex), WriteIndex(InWriteIndex), Weight(InWeight)
+		{
+		}
+	};
+
+	/** One source value of a union accumulation. Attribute must hold the same type as the operation. */
+	struct /*PCGEXTENDEDTOOLKIT_API*/ FUnionSample
+	{
+		const FPCGMetadataAttributeBase* Attribute = nullptr;
+		PCGMetadataEntryKey Key = PCGInvalidEntryKey;
+		double Weight = 0;
+	};
+
 	/**
 	 * 
 	 */
@@ -357,22 +384,30 @@ namespace PCGExDataBlending
 		FORCEINLINE virtual void PrepareOperation(const int32 WriteIndex) const { PrepareRangeOperation(WriteIndex, 1); }
 		FORCEINLINE virtual void DoOperation(const int32 PrimaryReadIndex, const int32 SecondaryReadIndex, const int32 WriteIndex, const double Weight, const bool bFirstOperation) const
 		{
-			TArray<double> Weights = {Weight};
-			DoRangeOperation(PrimaryReadIndex, SecondaryReadIndex, WriteIndex, Weights, bFirstOperation);
+			double InlineWeight = Weight;
+			DoRangeOperation(PrimaryReadIndex, SecondaryReadIndex, WriteIndex, MakeArrayView(&InlineWeight, 1), bFirstOperation);
 		}
 
 		FORCEINLINE virtual void DoOperation(const int32 PrimaryReadIndex, const FPCGPoint& SrcPoint, const int32 WriteIndex, const double Weight, const bool bFirstOperation) const = 0;
 		FORCEINLINE virtual void FinalizeOperation(const int32 WriteIndex, const int32 Count, const double TotalWeight) const
 		{
-			TArray<double> Weights = {TotalWeight};
-			TArray<int32> Counts = {Count};
-			FinalizeRangeOperation(WriteIndex, Counts, Weights);
+			double InlineWeight = TotalWeight;
+			FinalizeRangeOperation(WriteIndex, MakeArrayView(&Count, 1), MakeArrayView(&InlineWeight, 1));
 		}
 
 		FORCEINLINE virtual void PrepareRangeOperation(const int32 StartIndex, const int32 Range) const = 0;
 		FORCEINLINE virtual void DoRangeOperation(const int32 PrimaryReadIndex, const int32 SecondaryReadIndex, const int32 StartIndex, const TArrayView<double>& Weights, const bool bFirstOperation) const = 0;
 		FORCEINLINE virtual void FinalizeRangeOperation(const int32 StartIndex, const TArrayView<const int32>& Counts, const TArrayView<double>& TotalWeights) const = 0;
 
+		/** Same as calling DoOperation for each step, in order. */
+		virtual void DoOperations(const TArrayView<const FBlendStep>& Steps) const = 0;
+
+		/**
+		 * Blends all samples into WriteIndex in a single pass; same as calling DoOperation(WriteIndex, Sample, WriteIndex) for each of them.
+		 * @param bFirstSampleInits Whether the first sample is the first operation for WriteIndex.
+		 */
+		virtual void AccumulateOperation(const int32 WriteIndex, const TArrayView<const FUnionSample>& Samples, const bool bFirstSampleInits) const = 0;
+
 		// Soft ops
 
 		FORCEINLINE virtual void PrepareOperation(const PCGMetadataEntryKey WriteKey) const = 0;
@@ -466,57 +501,9 @@ namespace PCGExDataBlending
 			FinalizeValuesRangeOperation(StartIndex, View, Counts, TotalWeights);
 		}
 
-		FORCEINLINE virtual void PrepareValuesRangeOperation(TArrayView<T>& Values, const int32 StartIndex) const
-		{
-			for (int i = 0; i < Values.Num(); i++) { SinglePrepare(Values[i]); }
-		}
-
-		FORCEINLINE virtual void DoValuesRangeOperation(const int32 PrimaryReadIndex, const int32 SecondaryReadIndex, TArrayView<T>& Values, const TArrayView<double>& Weights, const bool bFirstOperation) const
-		{
-			if (!bSupportInterpolation)
-			{
-				const T B = Reader->Read(SecondaryReadIndex);
-				for (int i = 0; i < Values.Num(); i++) { Values[i] = B; } // Raw copy value
-			}
-			else
-			{
-				const T A = Writer->GetMutable(PrimaryReadIndex);
-				const T B = Reader->Read(SecondaryReadIndex);
-				for (int i = 0; i < Values.Num(); i++) { Values[i] = SingleOperation(A, B, Weights[i]); }
-			}
-		}
-
-		FORCEINLINE virtual void DoOperation(const int32 PrimaryReadIndex, const FPCGPoint& SrcPoint, const int32 WriteIndex, const double Weight, const bool bFirstOperation) const override
-		{
-			const T A = Writer->GetMutable(PrimaryReadIndex);
-			const T B = SourceAttribute ? SourceAttribute->GetValueFromItemKey(SrcPoint.MetadataEntry) : A;
-			Writer->GetMutable(WriteIndex) = SingleOperation(A, B, Weight);
-		}
-
-		FORCEINLINE virtual void FinalizeValuesRangeOperation(const int32 StartIndex, TArrayView<T>& Values, const TArrayView<const int32>& Counts, const TArrayView<double>& Weights) const
-		{
-			if (!bSupportInterpolation) { return; }
-			for (int i = 0; i < Values.Num(); i++) { SingleFinalize(Values[i], Counts[i], Weights[i]); }
-		}
-
-		FORCEINLINE virtual void PrepareOperation(const PCGMetadataEntryKey WriteKey) const override
-		{
-			T Value = TargetAttribute->GetValueFromItemKey(WriteKey);
-			SinglePrepare(Value);
-			TargetAttribute->SetValue(WriteKey, Value);
-		};
-
-		FORCEINLINE virtual void DoOperation(const PCGMetadataEntryKey PrimaryReadKey, const PCGMetadataEntryKey SecondaryReadKey, const PCGMetadataEntryKey WriteKey, const double Weight, const bool bFirstOperation) const override
-		{
-			TargetAttribute->SetValue(WriteKey, SingleOperation(TargetAttribute->GetValueFromItemKey(PrimaryReadKey), SourceAttribute->GetValueFromItemKey(SecondaryReadKey), Weight));
-		};
-
-		FORCEINLINE virtual void FinalizeOperation(const PCGMetadataEntryKey WriteKey, const int32 Count, const double TotalWeight) const override
-		{
-			T Value = TargetAttribute->GetValueFromItemKey(WriteKey);
-			SingleFinalize(Value, Count, TotalWeight);
-			TargetAttribute->SetValue(WriteKey, Value);
-		};
+		FORCEINLINE virtual void PrepareValuesRangeOperation(TArrayView<T>& Values, const int32 StartIndex) const = 0;
+		FORCEINLINE virtual void DoValuesRangeOperation(const int32 PrimaryReadIndex, const int32 SecondaryReadIndex, TArrayView<T>& Values, const TArrayView<double>& Weights, const bool bFirstOperation) const = 0;
+		FORCEINLINE virtual void FinalizeValuesRangeOperation(const int32 StartIndex, TArrayView<T>& Values, const TArrayView<const int32>& Counts, const TArrayView<double>& Weights) const = 0;
 
 		FORCEINLINE virtual void SinglePrepare(T& A) const
 		{
@@ -535,22 +522,31 @@ namespace PCGExDataBlending
 		TSharedPtr<PCGExData::TBuffer<T>> Reader;
 	};
 
-	template <typename T>
-	class /*PCGEXTENDEDTOOLKIT_API*/ FDataBlendingOperationWithFirstInit : public TDataBlendingOperation<T>
+	/**
+	 * Value loops of a concrete operation.
+	 * TOp is the final operation type, so its Single* methods are called directly instead of through the vtable :
+	 * a whole range or batch costs one virtual call, and range loops over plain values (float, double, vectors) are left
+	 * branch-free for the compiler to vectorize.
+	 * @tparam bFirstInit Whether the first operation on a target copies the secondary value instead of blending with it.
+	 */
+	template <typename T, typename TOp, bool bFirstInit = false>
+	class /*PCGEXTENDEDTOOLKIT_API*/ TDataBlendingKernel : public TDataBlendingOperation<T>
 	{
-		FORCEINLINE virtual void DoValuesRangeOperation(const int32 PrimaryReadIndex, const int32 SecondaryReadIndex, TArrayView<T>& Values, const TArrayView<double>& Weights, const bool bFirstOperation) const override
+		FORCEINLINE const TOp& Op() const { return *static_cast<const TOp*>(this); }
+
+		FORCEINLINE void BlendIndices(const int32 PrimaryReadIndex, const int32 SecondaryReadIndex, const int32 WriteIndex, const double Weight, const bool bFirstOperation) const
 		{
-			if (bFirstOperation || !this->bSupportInterpolation)
-			{
-				const T B = this->Reader->Read(SecondaryReadIndex);
-				for (int i = 0; i < Values.Num(); i++) { Values[i] = B; } // Raw copy value
-			}
-			else
-			{
-				T A = this->Writer->GetMutable(PrimaryReadIndex);
-				const T B = this->Reader->Read(SecondaryReadIndex);
-				for (int i = 0; i < Values.Num(); i++) { Values[i] = this->SingleOperation(A, B, Weights[i]); }
-			}
+			const T B = this->Reader->Read(SecondaryReadIndex);
+			if ((bFirstInit && bFirstOperation) || !this->bSupportInterpolation) { this->Writer->GetMutable(WriteIndex) = B; } // Raw copy value
+			else { this->Writer->GetMutable(WriteIndex) = Op().SingleOperation(this->Writer->GetMutable(PrimaryReadIndex), B, Weight); }
+		}
+
+	public:
+		FORCEINLINE virtual void PrepareOperation(const int32 WriteIndex) const override { Op().SinglePrepare(this->Writer->GetMutable(WriteIndex)); }
+
+		FORCEINLINE virtual void DoOperation(const int32 PrimaryReadIndex, const int32 SecondaryReadIndex, const int32 WriteIndex, const double Weight, const bool bFirstOperation) const override
+		{
+			BlendIndices(PrimaryReadIndex, SecondaryReadIndex, WriteIndex, Weight, bFirstOperation);
 		}
 
 		FORCEINLINE virtual void DoOperation(const int32 PrimaryReadIndex, const FPCGPoint& SrcPoint, const int32 WriteIndex, const double Weight, const bool bFirstOperation) const override
@@ -558,14 +554,97 @@ namespace PCGExDataBlending
 			const T A = this->Writer->GetMutable(PrimaryReadIndex);
 			const T B = this->SourceAttribute ? this->SourceAttribute->GetValueFromItemKey(SrcPoint.MetadataEntry) : A;
 
-			if (bFirstOperation)
+			if (bFirstInit && bFirstOperation)
 			{
 				this->Writer->GetMutable(WriteIndex) = B;
 				return;
 			}
 
-			this->Writer->GetMutable(WriteIndex) = this->SingleOperation(A, B, Weight);
+			this->Writer->GetMutable(WriteIndex) = Op().SingleOperation(A, B, Weight);
+		}
+
+		FORCEINLINE virtual void FinalizeOperation(const int32 WriteIndex, const int32 Count, const double TotalWeight) const override
+		{
+			if (!this->bSupportInterpolation) { return; }
+			Op().SingleFinalize(this->Writer->GetMutable(WriteIndex), Count, TotalWeight);
+		}
+
+		virtual void DoOperations(const TArrayView<const FBlendStep>& Steps) const override
+		{
+			for (const FBlendStep& Step : Steps) { BlendIndices(Step.PrimaryIndex, Step.SecondaryIndex, Step.WriteIndex, Step.Weight, Step.bFirstOperation); }
+		}
+
+		virtual void AccumulateOperation(const int32 WriteIndex, const TArrayView<const FUnionSample>& Samples, const bool bFirstSampleInits) const override
+		{
+			const TOp& Kernel = Op();
+			T Value = this->Writer->GetMutable(WriteIndex);
+
+			for (int i = 0; i < Samples.Num(); i++)
+			{
+				const FUnionSample& Sample = Samples[i];
+				const T B = Sample.Attribute ? static_cast<const FPCGMetadataAttribute<T>*>(Sample.Attribute)->GetValueFromItemKey(Sample.Key) : Value;
+
+				if (bFirstInit && bFirstSampleInits && i == 0) { Value = B; }
+				else { Value = Kernel.SingleOperation(Value, B, Sample.Weight); }
+			}
+
+			this->Writer->GetMutable(WriteIndex) = Value;
+		}
+
+		FORCEINLINE virtual void PrepareValuesRangeOperation(TArrayView<T>& Values, const int32 StartIndex) const override
+		{
+			const TOp& Kernel = Op();
+			for (int i = 0; i < Values.Num(); i++) { Kernel.SinglePrepare(Values[i]); }
+		}
+
+		FORCEINLINE virtual void DoValuesRangeOperation(const int32 PrimaryReadIndex, const int32 SecondaryReadIndex, TArrayView<T>& Values, const TArrayView<double>& Weights, const bool bFirstOperation) const override
+		{
+			const T B = this->Reader->Read(SecondaryReadIndex);
+
+			if ((bFirstInit && bFirstOperation) || !this->bSupportInterpolation)
+			{
+				for (int i = 0; i < Values.Num(); i++) { Values[i] = B; } // Raw copy value
+				return;
+			}
+
+			const TOp& Kernel = Op();
+			const T A = this->Writer->GetMutable(PrimaryReadIndex);
+			T* RESTRICT OutValues = Values.GetData();
+			const double* RESTRICT InWeights = Weights.GetData();
+			for (int i = 0; i < Values.Num(); i++) { OutValues[i] = Kernel.SingleOperation(A, B, InWeights[i]); }
+		}
+
+		FORCEINLINE virtual void FinalizeValuesRangeOperation(const int32 StartIndex, TArrayView<T>& Values, const TArrayView<const int32>& Counts, const TArrayView<double>& Weights) const override
+		{
+			if (!this->bSupportInterpolation) { return; }
+
+			const TOp& Kernel = Op();
+			T* RESTRICT OutValues = Values.GetData();
+			const int32* RESTRICT InCounts = Counts.GetData();
+			const double* RESTRICT InWeights = Weights.GetData();
+			for (int i = 0; i < Values.Num(); i++) { Kernel.SingleFinalize(OutValues[i], InCounts[i], InWeights[i]); }
 		}
+
+		// Soft ops
+
+		FORCEINLINE virtual void PrepareOperation(const PCGMetadataEntryKey WriteKey) const override
+		{
+			T Value = this->TargetAttribute->GetValueFromItemKey(WriteKey);
+			Op().SinglePrepare(Value);
+			this->TargetAttribute->SetValue(WriteKey, Value);
+		};
+
+		FORCEINLINE virtual void DoOperation(const PCGMetadataEntryKey PrimaryReadKey, const PCGMetadataEntryKey SecondaryReadKey, const PCGMetadataEntryKey WriteKey, const double Weight, const bool bFirstOperation) const override
+		{
+			this->TargetAttribute->SetValue(WriteKey, Op().SingleOperation(this->TargetAttribute->GetValueFromItemKey(PrimaryReadKey), this->SourceAttribute->GetValueFromItemKey(SecondaryReadKey), Weight));
+		};
+
+		FORCEINLINE virtual void FinalizeOperation(const PCGMetadataEntryKey WriteKey, const int32 Count, const double TotalWeight) const override
+		{
+			T Value = this->TargetAttribute->GetValueFromItemKey(WriteKey);
+			Op().SingleFinalize(Value, Count, TotalWeight);
+			this->TargetAttribute->SetValue(WriteKey, Value);
+		};
 	};
 
 	static void AssembleBlendingDetails(
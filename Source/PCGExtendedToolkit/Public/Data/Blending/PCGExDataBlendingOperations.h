@@ -25,7 +25,7 @@ PCGEX_BLEND_CASE(WeightedSubtract)
 namespace PCGExDataBlending
 {
 	template <typename T>
-	class /*PCGEXTENDEDTOOLKIT_API*/ TDataBlendingAverage final : public TDataBlendingOperation<T>
+	class /*PCGEXTENDEDTOOLKIT_API*/ TDataBlendingAverage final : public TDataBlendingKernel<T, TDataBlendingAverage<T>>
 	{
 	public:
 		FORCEINLINE virtual EPCGExDataBlendingType GetBlendingType() const override { return EPCGExDataBlendingType::Average; };
@@ -38,7 +38,7 @@ namespace PCGExDataBlending
 	};
 
 	template <typename T>
-	class /*PCGEXTENDEDTOOLKIT_API*/ TDataBlendingCopy final : public TDataBlendingOperation<T>
+	class /*PCGEXTENDEDTOOLKIT_API*/ TDataBlendingCopy final : public TDataBlendingKernel<T, TDataBlendingCopy<T>>
 	{
 	public:
 		FORCEINLINE virtual EPCGExDataBlendingType GetBlendingType() const override { return EPCGExDataBlendingType::Copy; };
@@ -46,7 +46,7 @@ namespace PCGExDataBlending
 	};
 
 	template <typename T>
-	class /*PCGEXTENDEDTOOLKIT_API*/ TDataBlendingSum final : public TDataBlendingOperation<T>
+	class /*PCGEXTENDEDTOOLKIT_API*/ TDataBlendingSum final : public TDataBlendingKernel<T, TDataBlendingSum<T>>
 	{
 	public:
 		FORCEINLINE virtual EPCGExDataBlendingType GetBlendingType() const override { return EPCGExDataBlendingType::Sum; };
@@ -58,7 +58,7 @@ namespace PCGExDataBlending
 	};
 
 	template <typename T>
-	class /*PCGEXTENDEDTOOLKIT_API*/ TDataBlendingSubtract final : public TDataBlendingOperation<T>
+	class /*PCGEXTENDEDTOOLKIT_API*/ TDataBlendingSubtract final : public TDataBlendingKernel<T, TDataBlendingSubtract<T>>
 	{
 	public:
 		FORCEINLINE virtual EPCGExDataBlendingType GetBlendingType() const override { return EPCGExDataBlendingType::Subtract; };
@@ -70,7 +70,7 @@ namespace PCGExDataBlending
 	};
 
 	template <typename T>
-	class /*PCGEXTENDEDTOOLKIT_API*/ TDataBlendingMax final : public FDataBlendingOperationWithFirstInit<T>
+	class /*PCGEXTENDEDTOOLKIT_API*/ TDataBlendingMax final : public TDataBlendingKernel<T, TDataBlendingMax<T>, true>
 	{
 	public:
 		FORCEINLINE virtual EPCGExDataBlendingType GetBlendingType() const override { return EPCGExDataBlendingType::Max; };
@@ -78,7 +78,7 @@ namespace PCGExDataBlending
 	};
 
 	template <typename T>
-	class /*PCGEXTENDEDTOOLKIT_API*/ TDataBlendingMin final : public FDataBlendingOperationWithFirstInit<T>
+	class /*PCGEXTENDEDTOOLKIT_API*/ TDataBlendingMin final : public TDataBlendingKernel<T, TDataBlendingMin<T>, true>
 	{
 	public:
 		FORCEINLINE virtual EPCGExDataBlendingType GetBlendingType() const override { return EPCGExDataBlendingType::Min; };
@@ -86,7 +86,7 @@ namespace PCGExDataBlending
 	};
 
 	template <typename T>
-	class /*PCGEXTENDEDTOOLKIT_API*/ TDataBlendingWeight final : public TDataBlendingOperation<T>
+	class /*PCGEXTENDEDTOOLKIT_API*/ TDataBlendingWeight final : public TDataBlendingKernel<T, TDataBlendingWeight<T>>
 	{
 	public:
 		FORCEINLINE virtual EPCGExDataBlendingType GetBlendingType() const override { return EPCGExDataBlendingType::Weight; };
@@ -99,7 +99,7 @@ namespace PCGExDataBlending
 	};
 
 	template <typename T>
-	class /*PCGEXTENDEDTOOLKIT_API*/ TDataBlendingWeightedSum final : public TDataBlendingOperation<T>
+	class /*PCGEXTENDEDTOOLKIT_API*/ TDataBlendingWeightedSum final : public TDataBlendingKernel<T, TDataBlendingWeightedSum<T>>
 	{
 	public:
 		FORCEINLINE virtual EPCGExDataBlendingType GetBlendingType() const override { return EPCGExDataBlendingType::WeightedSum; };
@@ -111,7 +111,7 @@ namespace PCGExDataBlending
 	};
 
 	template <typename T>
-	class /*PCGEXTENDEDTOOLKIT_API*/ TDataBlendingLerp final : public TDataBlendingOperation<T>
+	class /*PCGEXTENDEDTOOLKIT_API*/ TDataBlendingLerp final : public TDataBlendingKernel<T, TDataBlendingLerp<T>>
 	{
 	public:
 		FORCEINLINE virtual EPCGExDataBlendingType GetBlendingType() const override { return EPCGExDataBlendingType::Lerp; };
@@ -119,14 +119,14 @@ namespace PCGExDataBlending
 	};
 
 	template <typename T>
-	class /*PCGEXTENDEDTOOLKIT_API*/ TDataBlendingNone final : public FDataBlendingOperationWithFirstInit<T>
+	class /*PCGEXTENDEDTOOLKIT_API*/ TDataBlendingNone final : public TDataBlendingKernel<T, TDataBlendingNone<T>, true>
 	{
 	public:
 		FORCEINLINE virtual T SingleOperation(T A, T B, double Weight) const override { return A; }
 	};
 
 	template <typename T>
-	class /*PCGEXTENDEDTOOLKIT_API*/ TDataBlendingUnsignedMax final : public FDataBlendingOperationWithFirstInit<T>
+	class /*PCGEXTENDEDTOOLKIT_API*/ TDataBlendingUnsignedMax final : public TDataBlendingKernel<T, TDataBlendingUnsignedMax<T>, true>
 	{
 	public:
 		FORCEINLINE virtual EPCGExDataBlendingType GetBlendingType() const override { return EPCGExDataBlendingType::UnsignedMax; };
@@ -134,7 +134,7 @@ namespace PCGExDataBlending
 	};
 
 	template <typename T>
-	class /*PCGEXTENDEDTOOLKIT_API*/ TDataBlendingUnsignedMin final : public FDataBlendingOperationWithFirstInit<T>
+	class /*PCGEXTENDEDTOOLKIT_API*/ TDataBlendingUnsignedMin final : public TDataBlendingKernel<T, TDataBlendingUnsignedMin<T>, true>
 	{
 	public:
 		FORCEINLINE virtual EPCGExDataBlendingType GetBlendingType() const override { return EPCGExDataBlendingType::UnsignedMin; };
@@ -142,7 +142,7 @@ namespace PCGExDataBlending
 	};
 
 	template <typename T>
-	class /*PCGEXTENDEDTOOLKIT_API*/ TDataBlendingAbsoluteMax final : public FDataBlendingOperationWithFirstInit<T>
+	class /*PCGEXTENDEDTOOLKIT_API*/ TDataBlendingAbsoluteMax final : public TDataBlendingKernel<T, TDataBlendingAbsoluteMax<T>, true>
 	{
 	public:
 		FORCEINLINE virtual EPCGExDataBlendingType GetBlendingType() const override { return EPCGExDataBlendingType::AbsoluteMax; };
@@ -150,7 +150,7 @@ namespace PCGExDataBlending
 	};
 
 	template <typename T>
-	class /*PCGEXTENDEDTOOLKIT_API*/ TDataBlendingAbsoluteMin final : public FDataBlendingOperationWithFirstInit<T>
+	class /*PCGEXTENDEDTOOLKIT_API*/ TDataBlendingAbsoluteMin final : public TDataBlendingKernel<T, TDataBlendingAbsoluteMin<T>, true>
 	{
 	public:
 		FORCEINLINE virtual EPCGExDataBlendingType GetBlendingType() const override { return EPCGExDataBlendingType::AbsoluteMin; };
@@ -158,7 +158,7 @@ namespace PCGExDataBlending
 	};
 
 	template <typename T>
-	class /*PCGEXTENDEDTOOLKIT_API*/ TDataBlendingWeightedSubtract final : public TDataBlendingOperation<T>
+	class /*PCGEXTENDEDTOOLKIT_API*/ TDataBlendingWeightedSubtract final : public TDataBlendingKernel<T, TDataBlendingWeightedSubtract<T>>
 	{
 	public:
 		FORCEINLINE virtual EPCGExDataBlendingType GetBlendingType() const override { return EPCGExDataBlendingType::WeightedSubtract; };
@@ -72,6 +72,12 @@ namespace PCGExDataBlending
 			PropertiesBlender->Blend(*(PrimaryPoints->GetData() + PrimaryIndex), *(SecondaryPoints->GetData() + SecondaryIndex), (*PrimaryPoints)[TargetIndex], Weight);
 		}
 
+		/**
+		 * Runs all steps through each attribute operation in turn, instead of every operation for each step.
+		 * Same result as calling Blend for each step, in order; first-operation flags are filled in from the blender's state.
+		 */
+		void BlendBatch(const TArrayView<FBlendStep>& Steps);
+
 		FORCEINLINE void CompleteBlending(const PCGExData::FPointRef& Target, const int32 Count, const double TotalWeight) const
 		{
 			for (const FDataBlendingOperationBase* Op : OperationsToBeCompleted) { Op->FinalizeOperation(Target.Index, Count, TotalWeight); }
@@ -92,6 +92,13 @@ namespace PCGExData
 		{
 		}
 
+		/** Writes [StartIndex, StartIndex + Count[ only. Output entries must be initialized beforehand so ranges can be written concurrently. */
+		virtual void WriteRange(const int32 StartIndex, const int32 Count)
+		{
+		}
+
+		FORCEINLINE int32 GetNumOut() const { return OutPoints.Num(); }
+
 		virtual void Fetch(const int32 StartIndex, const int32 Count)
 		{
 		}
@@ -118,6 +125,60 @@ namespace PCGExData
 		TSharedPtr<TArray<T>> InValues;
 		TSharedPtr<TArray<T>> OutValues;
 
+		// Demand-paged reads
+		static constexpr int32 PageShift = 12;
+		static constexpr int32 PageSize = 1 << PageShift;
+		static constexpr int8 PageAbsent = 0;
+		static constexpr int8 PageLoading = 1;
+		static constexpr int8 PageResident = 2;
+
+		TSharedPtr<PCGEx::TAttributeBroadcaster<T>> PagedBroadcaster;
+		TUniquePtr<std::atomic<int8>[]> PageStates;
+		int32 NumPages = 0;
+		int32 ResidencyBudget = 0;
+		mutable std::atomic<int32> NumPagedIn{0};
+
+		bool ClaimPage(const int32 PageIndex) const
+		{
+			int8 Expected = PageAbsent;
+			return PageStates[PageIndex].compare_exchange_strong(Expected, PageLoading, std::memory_order_acquire);
+		}
+
+		void PageIn(const int32 PageIndex) const
+		{
+			const int32 StartIndex = PageIndex << PageShift;
+			PagedBroadcaster->Fetch(*InValues, StartIndex, FMath::Min(PageSize, InValues->Num() - StartIndex));
+			PageStates[PageIndex].store(PageResident, std::memory_order_release);
+		}
+
+		void PageInRemaining() const
+		{
+			// Pages already being read by other threads are left to them
+			for (int i = 0; i < NumPages; i++) { if (ClaimPage(i)) { PageIn(i); } }
+		}
+
+		void RequirePage(const int32 PageIndex) const
+		{
+			std::atomic<int8>& State = PageStates[PageIndex];
+			if (State.load(std::memory_order_acquire) == PageResident) { return; }
+
+			if (ClaimPage(PageIndex))
+			{
+				PageIn(PageIndex);
+				if (NumPagedIn.fetch_add(1, std::memory_order_relaxed) + 1 == ResidencyBudget) { PageInRemaining(); }
+				return;
+			}
+
+			while (State.load(std::memory_order_acquire) != PageResident) { FPlatformProcess::Yield(); }
+		}
+
+		void RequireAllPages() const
+		{
+			if (!PageStates) { return; }
+			PageInRemaining();
+			for (int i = 0; i < NumPages; i++) { RequirePage(i); }
+		}
+
 	public:
 		T Min = T{};
 		T Max = T{};
@@ -140,14 +201,37 @@ namespace PCGExData
 		virtual bool IsWritable() override { return OutValues ? true : false; }
 		virtual bool IsReadable() override { return InValues ? true : false; }
 
-		TSharedPtr<TArray<T>> GetInValues() { return InValues; }
+		TSharedPtr<TArray<T>> GetInValues()
+		{
+			RequireAllPages(); // Raw access bypasses paging
+			return InValues;
+		}
+
+		bool IsPaged() const { return PageStates.IsValid(); }
+
 		TSharedPtr<TArray<T>> GetOutValues() { return OutValues; }
 		const FPCGMetadataAttribute<T>* GetTypedInAttribute() const { return TypedInAttribute; }
 		FPCGMetadataAttribute<T>* GetTypedOutAttribute() { return TypedOutAttribute; }
 
 		FORCEINLINE T& GetMutable(const int32 Index) { return *(OutValues->GetData() + Index); }
 		FORCEINLINE const T& GetConst(const int32 Index) { return *(OutValues->GetData() + Index); }
-		FORCEINLINE const T& Read(const int32 Index) const { return *(InValues->GetData() + Index); }
+		FORCEINLINE const T& Read(const int32 Index) const
+		{
+			if (PageStates) { RequirePage(Index >> PageShift); }
+			return *(InValues->GetData() + Index);
+		}
+		/** Contiguous view over [StartIndex, StartIndex + Count[, for loops that go over a whole scope at once. */
+		TArrayView<const T> ReadSpan(const int32 StartIndex, const int32 Count) const
+		{
+			if (PageStates && Count > 0)
+			{
+				const int32 LastPage = (StartIndex + Count - 1) >> PageShift;
+				for (int i = StartIndex >> PageShift; i <= LastPage; i++) { RequirePage(i); }
+			}
+
+			return MakeArrayView(InValues->GetData() + StartIndex, Count);
+		}
+
 		FORCEINLINE const T& ReadImmediate(const int32 Index) const { return TypedInAttribute->GetValueFromItemKey(InPoints[Index]); }
 
 		FORCEINLINE void Set(const int32 Index, const T& Value) { *(OutValues->GetData() + Index) = Value; }
@@ -305,6 +389,22 @@ namespace PCGExData
 			return PrepareWrite(T{}, true, bUninitialized);
 		}
 
+		/** Values are read from the getter one page at a time, the first time any index of that page is read. */
+		void SetPagedGetter(const TSharedRef<PCGEx::TAttributeBroadcaster<T>>& Getter, const double InResidencyBudget)
+		{
+			FWriteScopeLock WriteScopeLock(BufferLock);
+
+			if (InValues) { return; }
+
+			PrepareReadInternal(false, Getter->GetAttribute());
+			PagedBroadcaster = Getter;
+
+			NumPages = FMath::DivideAndRoundUp(InValues->Num(), PageSize);
+			ResidencyBudget = FMath::Max(1, FMath::CeilToInt32(NumPages * InResidencyBudget));
+			PageStates = MakeUnique<std::atomic<int8>[]>(NumPages);
+			for (int i = 0; i < NumPages; i++) { PageStates[i].store(PageAbsent, std::memory_order_relaxed); }
+		}
+
 		void SetScopedGetter(const TSharedRef<PCGEx::TAttributeBroadcaster<T>>& Getter)
 		{
 			FWriteScopeLock WriteScopeLock(BufferLock);
@@ -323,6 +423,14 @@ namespace PCGExData
 			OutAccessor->SetRange(View, 0, *Source->GetOutKeys(true).Get());
 		}
 
+		virtual void WriteRange(const int32 StartIndex, const int32 Count) override
+		{
+			if (!IsWritable() || !OutAccessor || !OutValues || !TypedOutAttribute) { return; }
+
+			TArrayView<const T> View = MakeArrayView(OutValues->GetData() + StartIndex, Count);
+			OutAccessor->SetRange(View, StartIndex, *Source->GetOutKeys(true).Get());
+		}
+
 		virtual void Fetch(const int32 StartIndex, const int32 Count) override
 		{
 			if (!IsScoped()) { return; }
@@ -340,11 +448,20 @@ namespace PCGExData
 			//}
 		}
 
+		/** After a full read of InValues, paging has nothing left to do. */
+		void MarkAllPagesResident()
+		{
+			for (int i = 0; i < NumPages; i++) { PageStates[i].store(PageResident, std::memory_order_release); }
+		}
+
 		void Flush()
 		{
 			InValues.Reset();
 			OutValues.Reset();
 			ScopedBroadcaster.Reset();
+			PagedBroadcaster.Reset();
+			PageStates.Reset();
+			NumPages = 0;
 		}
 	};
 
@@ -427,10 +544,19 @@ namespace PCGExData
 
 			TSharedPtr<TBuffer<T>> Buffer = GetBuffer<T>(Getter->FullName);
 
+			// Min/Max need every value anyway
+			const UPCGExGlobalSettings* GlobalSettings = GetDefault<UPCGExGlobalSettings>();
+			if (!bCaptureMinMax && GlobalSettings->bLazyBroadcasters && Source->GetNum() >= GlobalSettings->LazyBroadcasterMinPoints)
+			{
+				Buffer->SetPagedGetter(Getter.ToSharedRef(), GlobalSettings->LazyBroadcasterResidencyBudget);
+				return Buffer;
+			}
+
 			{
 				FWriteScopeLock WriteScopeLock(Buffer->BufferLock);
 				Buffer->PrepareReadInternal(false, Getter->GetAttribute());
-				Getter->GrabAndDump(*Buffer->GetInValues(), bCaptureMinMax, Buffer->Min, Buffer->Max);
+				Getter->GrabAndDump(*Buffer->InValues, bCaptureMinMax, Buffer->Min, Buffer->Max);
+				Buffer->MarkAllPagesResident();
 			}
 
 			return Buffer;
@@ -568,6 +694,8 @@ namespace PCGExData
 			BufferMap.Empty();
 		}
 
+		static constexpr int32 WriteChunkSize = 16384;
+
 		void Write(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager);
 		void WriteBuffersAsCallbacks(const TSharedPtr<PCGExMT::FTaskGroup>& TaskGroup);
 
@@ -575,6 +703,9 @@ namespace PCGExData
 		void Fetch(const uint64 Scope) { Fetch(PCGEx::H64A(Scope), PCGEx::H64B(Scope)); }
 
 	protected:
+		/** Splits writable buffers into H64(WritableIndex, StartIndex) scopes of at most WriteChunkSize values, buffer after buffer. */
+		int32 GetWriteScopes(TArray<TSharedPtr<FBufferBase>>& OutWritables, TArray<uint64>& OutScopes);
+
 		void Flush(const TSharedPtr<FBufferBase>& Buffer)
 		{
 			FWriteScopeLock WriteScopeLock(PoolLock);
@@ -127,6 +127,8 @@ namespace PCGExFilterGroup
 			for (const TSharedPtr<PCGExPointFilter::FFilter>& Filter : ManagedFilters) { if (!Filter->Test(Edge)) { return bInvert; } }
 			return !bInvert;
 		}
+
+		virtual void TestScope(const int32 StartIndex, const int32 Count, uint64* InOutMask) const override;
 	};
 
 	class /*PCGEXTENDEDTOOLKIT_API*/ FFilterGroupOR final : public FFilterGroup
@@ -154,5 +156,7 @@ namespace PCGExFilterGroup
 			for (const TSharedPtr<PCGExPointFilter::FFilter>& Filter : ManagedFilters) { if (Filter->Test(Edge)) { return !bInvert; } }
 			return bInvert;
 		}
+
+		virtual void TestScope(const int32 StartIndex, const int32 Count, uint64* InOutMask) const override;
 	};
 }
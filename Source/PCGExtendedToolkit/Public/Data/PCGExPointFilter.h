@@ -1,4 +1,4 @@
-// Copyright Timothé Lapetite 2024
+﻿// Copyright Timothé Lapetite 2024
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #pragma once
@@ -68,6 +68,31 @@ namespace PCGExPointFilter
 	const FName OutputInsideFiltersLabel = FName("Inside");
 	const FName OutputOutsideFiltersLabel = FName("Outside");
 
+	// Scope results are packed one bit per index in 64-bit words, bit 0 of the first word being the scope's first index.
+	FORCEINLINE static int32 NumMaskWords(const int32 Count) { return (Count + 63) >> 6; }
+
+	/**
+	 * ANDs Predicate(ScopeIndex) into every word of InOutMask that still has bits set.
+	 * All indices of such a word are evaluated, passing or not, so the inner loop has no branch on results and can vectorize.
+	 */
+	template <typename FPredicate>
+	FORCEINLINE static void AndMask(const int32 Count, uint64* InOutMask, FPredicate&& Predicate)
+	{
+		const int32 NumWords = NumMaskWords(Count);
+		for (int w = 0; w < NumWords; w++)
+		{
+			if (!InOutMask[w]) { continue; }
+
+			const int32 First = w << 6;
+			const int32 Num = FMath::Min(64, Count - First);
+
+			uint64 Word = 0;
+			for (int i = 0; i < Num; i++) { Word |= static_cast<uint64>(Predicate(First + i) ? 1 : 0) << i; }
+
+			InOutMask[w] &= Word;
+		}
+	}
+
 	class /*PCGEXTENDEDTOOLKIT_API*/ FFilter
 	{
 	public:
@@ -95,6 +120,13 @@ namespace PCGExPointFilter
 		virtual bool Test(const PCGExCluster::FNode& Node) const;
 		virtual bool Test(const PCGExGraph::FIndexedEdge& Edge) const;
 
+		/**
+		 * Tests [StartIndex, StartIndex + Count[ at once, clearing the bits of indices that fail.
+		 * Only indices whose bit is set need to pass; bits past Count must be cleared by the caller.
+		 * Default implementation calls Test(Index) for every set bit.
+		 */
+		virtual void TestScope(const int32 StartIndex, const int32 Count, uint64* InOutMask) const;
+
 		virtual ~FFilter() = default;
 	};
 
@@ -130,6 +162,12 @@ namespace PCGExPointFilter
 		virtual bool Test(const PCGExCluster::FNode& Node);
 		virtual bool Test(const PCGExGraph::FIndexedEdge& Edge);
 
+		/** Point-index scope test; filters are ANDed word by word, and stop as soon as no index of the scope passes anymore. */
+		virtual void TestScope(const int32 StartIndex, const int32 Count, uint64* InOutMask);
+
+		/** Same as Test(Index) for every index of the scope, written to OutResults[Index]. */
+		void TestScope(const int32 StartIndex, const int32 Count, TArray<bool>& OutResults);
+
 		virtual ~FManager()
 		{
 		}
@@ -142,5 +180,8 @@ namespace PCGExPointFilter
 		virtual void PostInitFilter(const FPCGContext* InContext, const TSharedPtr<FFilter>& InFilter);
 
 		virtual void InitCache();
+
+		/** Runs the virtual Test(Index) on every index still set in the mask, for managers whose Test has side effects. */
+		void TestScopePerIndex(const int32 StartIndex, const int32 Count, uint64* InOutMask);
 	};
 }
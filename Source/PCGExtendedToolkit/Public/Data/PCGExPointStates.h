@@ -100,6 +100,10 @@ namespace PCGExPointStates
 
 		virtual bool Test(const int32 Index) override;
 
+		// Test writes flags, every index must go through it
+		using PCGExPointFilter::FManager::TestScope;
+		virtual void TestScope(const int32 StartIndex, const int32 Count, uint64* InOutMask) override { TestScopePerIndex(StartIndex, Count, InOutMask); }
+
 	protected:
 		virtual void PostInitFilter(const FPCGContext* InContext, const TSharedPtr<PCGExPointFilter::FFilter>& InFilter) override;
 	};
@@ -7,9 +7,140 @@
 #include "PCGExGeo.h"
 #include "CompGeom/Delaunay2.h"
 #include "CompGeom/Delaunay3.h"
+#include "PCGExMT.h"
 
 namespace PCGExGeo
 {
+	namespace DelaunayOrder
+	{
+		// Insertion order follows BRIO : points are spread over rounds of geometrically growing size, randomly,
+		// and each round is walked along a space-filling curve. Incremental insertion then locates each new point
+		// close to the previous one while keeping the randomization that bounds its expected cost.
+		//
+		// Note that the Delaunay triangulation of degenerate input (grids, cocircular/cospherical points) is not unique:
+		// ties are broken by insertion order, so such input may not triangulate the same way as when points were inserted
+		// in their original order. Output is still deterministic for a given set of positions, and the ordering is
+		// only derived from the positions & point indices.
+
+		constexpr int32 CurveBits = 12; // Per axis in 2D, 8 per axis in 3D; fine enough for locality
+
+		FORCEINLINE static uint32 Hilbert2D(uint32 X, uint32 Y)
+		{
+			constexpr uint32 N = 1 << CurveBits;
+			uint32 D = 0;
+			for (uint32 S = N >> 1; S > 0; S >>= 1)
+			{
+				const uint32 RX = (X & S) > 0;
+				const uint32 RY = (Y & S) > 0;
+				D += S * S * ((3 * RX) ^ RY);
+
+				if (RY == 0)
+				{
+					if (RX == 1)
+					{
+						X = N - 1 - X;
+						Y = N - 1 - Y;
+					}
+					Swap(X, Y);
+				}
+			}
+			return D;
+		}
+
+		FORCEINLINE static uint32 Morton3D(const uint32 X, const uint32 Y, const uint32 Z)
+		{
+			uint32 D = 0;
+			for (int32 i = 0; i < 8; i++)
+			{
+				D |= ((X >> i) & 1) << (3 * i) | ((Y >> i) & 1) << (3 * i + 1) | ((Z >> i) & 1) << (3 * i + 2);
+			}
+			return D;
+		}
+
+		FORCEINLINE static uint32 Quantize(const double Value, const double Min, const double InvSize, const uint32 Max)
+		{
+			return static_cast<uint32>(FMath::Clamp((Value - Min) * InvSize * Max, 0.0, static_cast<double>(Max)));
+		}
+
+		/** Curve key in the low 26 bits, inverted round in the bits above; packed with the point index so a plain sort gives the order. */
+		template <typename TGetKey>
+		static void Sort(const int32 NumPoints, TGetKey&& GetCurveKey, TArray<int32>& OutOrder)
+		{
+			const int32 MaxRound = FMath::Min(FMath::FloorLog2(FMath::Max(1, NumPoints)), 31);
+
+			TArray<uint64> Keys;
+			Keys.SetNumUninitialized(NumPoints);
+
+			ParallelFor(
+				NumPoints, [&](const int32 Index)
+				{
+					const int32 Round = FMath::Min(static_cast<int32>(FMath::CountLeadingZeros64(PCGEx::M64(Index))), MaxRound);
+					const uint64 Key = static_cast<uint64>(MaxRound - Round) << 26 | GetCurveKey(Index);
+					Keys[Index] = Key << 32 | static_cast<uint32>(Index);
+				});
+
+			PCGExMT::ParallelSort(Keys);
+
+			OutOrder.SetNumUninitialized(NumPoints);
+			for (int i = 0; i < NumPoints; i++) { OutOrder[i] = static_cast<int32>(PCGEx::H64B(Keys[i])); }
+		}
+
+		static void Sort(const TArray<FVector2D>& Positions, TArray<int32>& OutOrder)
+		{
+			FBox2D Box(ForceInit);
+			for (const FVector2D& P : Positions) { Box += P; }
+			const FVector2D InvSize = FVector2D(1) / Box.GetSize().ComponentMax(FVector2D(UE_SMALL_NUMBER));
+			constexpr uint32 Max = (1 << CurveBits) - 1;
+
+			Sort(
+				Positions.Num(), [&](const int32 Index)
+				{
+					const FVector2D& P = Positions[Index];
+					return Hilbert2D(Quantize(P.X, Box.Min.X, InvSize.X, Max), Quantize(P.Y, Box.Min.Y, InvSize.Y, Max));
+				}, OutOrder);
+		}
+
+		static void Sort(const TArrayView<FVector>& Positions, TArray<int32>& OutOrder)
+		{
+			FBox Box(ForceInit);
+			for (const FVector& P : Positions) { Box += P; }
+			const FVector InvSize = FVector(1) / Box.GetSize().ComponentMax(FVector(UE_SMALL_NUMBER));
+			constexpr uint32 Max = (1 << 8) - 1;
+
+			Sort(
+				Positions.Num(), [&](const int32 Index)
+				{
+					const FVector& P = Positions[Index];
+					return Morton3D(Quantize(P.X, Box.Min.X, InvSize.X, Max), Quantize(P.Y, Box.Min.Y, InvSize.Y, Max), Quantize(P.Z, Box.Min.Z, InvSize.Z, Max));
+				}, OutOrder);
+		}
+
+		/** Sorts & dedupes an edge list in place. */
+		static void SortUnique(TArray<uint64>& Edges)
+		{
+			PCGExMT::ParallelSort(Edges);
+
+			int32 WriteIndex = 0;
+			for (int i = 0; i < Edges.Num(); i++) { if (i == 0 || Edges[i] != Edges[i - 1]) { Edges[WriteIndex++] = Edges[i]; } }
+			Edges.SetNum(WriteIndex);
+		}
+
+		/** Removes every edge found in SortedRemovals from SortedEdges, both sorted. */
+		static void RemoveSorted(TArray<uint64>& SortedEdges, const TArray<uint64>& SortedRemovals)
+		{
+			int32 WriteIndex = 0;
+			int32 r = 0;
+			for (int i = 0; i < SortedEdges.Num(); i++)
+			{
+				const uint64 Edge = SortedEdges[i];
+				while (r < SortedRemovals.Num() && SortedRemovals[r] < Edge) { r++; }
+				if (r < SortedRemovals.Num() && SortedRemovals[r] == Edge) { continue; }
+				SortedEdges[WriteIndex++] = Edge;
+			}
+			SortedEdges.SetNum(WriteIndex);
+		}
+	}
+
 	struct FDelaunaySite2
 	{
 		int32 Vtx[3];
@@ -48,7 +179,7 @@ namespace PCGExGeo
 	public:
 		TArray<FDelaunaySite2> Sites;
 
-		TSet<uint64> DelaunayEdges;
+		TArray<uint64> DelaunayEdges; // Sorted, unique
 		TSet<int32> DelaunayHull;
 		bool IsValid = false;
 
@@ -72,6 +203,7 @@ namespace PCGExGeo
 			IsValid = false;
 		}
 
+		/** Points are inserted in DelaunayOrder; on degenerate input (e.g. grids), ties resolve according to that order rather than the input one. */
 		bool Process(const TArrayView<FVector>& Positions, const FPCGExGeo2DProjectionDetails& ProjectionDetails)
 		{
 			Clear();
@@ -81,6 +213,9 @@ namespace PCGExGeo
 			TArray<FVector2D> Positions2D;
 			ProjectionDetails.Project(Positions, Positions2D);
 
+			TArray<int32> Order;
+			DelaunayOrder::Sort(Positions2D, Order);
+
 			TArray<UE::Geometry::FIndex3i> Triangles;
 			TArray<UE::Geometry::FIndex3i> Adjacencies;
 
@@ -88,77 +223,75 @@ namespace PCGExGeo
 				UE::Geometry::FDelaunay2 Triangulation;
 				TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay2D::Triangulate);
 
-				if (!Triangulation.Triangulate(Positions2D))
+				TArray<FVector2D> OrderedPositions;
+				OrderedPositions.SetNumUninitialized(Order.Num());
+				for (int i = 0; i < Order.Num(); i++) { OrderedPositions[i] = Positions2D[Order[i]]; }
+				Positions2D.Empty();
+
+				if (!Triangulation.Triangulate(OrderedPositions))
 				{
-					Positions2D.Empty();
 					Clear();
 					return false;
 				}
 
-				Positions2D.Empty();
 				IsValid = true;
 				Triangulation.GetTrianglesAndAdjacency(Triangles, Adjacencies);
 			}
 
 			const int32 NumSites = Triangles.Num();
-			const int32 NumReserve = NumSites * 3;
-
-			DelaunayEdges.Reserve(NumReserve);
 
 			PCGEx::InitArray(Sites, NumSites);
+			DelaunayEdges.SetNumUninitialized(NumSites * 3);
 
-			for (int i = 0; i < NumSites; i++)
-			{
-				FDelaunaySite2& Site = Sites[i] = FDelaunaySite2(Triangles[i], Adjacencies[i], i);
-
-				for (int a = 0; a < 3; a++)
+			ParallelFor(
+				NumSites, [&](const int32 i)
 				{
-					for (int b = a + 1; b < 3; b++)
-					{
-						const uint64 H = PCGEx::H64U(Site.Vtx[a], Site.Vtx[b]);
-						DelaunayEdges.Add(H);
+					UE::Geometry::FIndex3i& Triangle = Triangles[i];
+					for (int v = 0; v < 3; v++) { Triangle[v] = Order[Triangle[v]]; }
 
-						if (Site.Neighbors[b] == -1)
-						{
-							Site.bOnHull = true;
-							DelaunayHull.Add(Site.Vtx[b]);
-						}
-					}
+					FDelaunaySite2& Site = Sites[i] = FDelaunaySite2(Triangle, Adjacencies[i], i);
 
-					if (Site.Neighbors[a] == -1)
-					{
-						Site.bOnHull = true;
-						DelaunayHull.Add(Site.Vtx[a]);
-						//DelaunayHull.Add(Site.Vtx[PCGExMath::Tile(a + 1, 0, 2)]);
-					}
-				}
+					DelaunayEdges[i * 3] = PCGEx::H64U(Site.Vtx[0], Site.Vtx[1]);
+					DelaunayEdges[i * 3 + 1] = PCGEx::H64U(Site.Vtx[0], Site.Vtx[2]);
+					DelaunayEdges[i * 3 + 2] = PCGEx::H64U(Site.Vtx[1], Site.Vtx[2]);
+
+					for (int v = 0; v < 3; v++) { if (Site.Neighbors[v] == -1) { Site.bOnHull = true; } }
+				});
+
+			for (const FDelaunaySite2& Site : Sites)
+			{
+				if (!Site.bOnHull) { continue; }
+				for (int v = 0; v < 3; v++) { if (Site.Neighbors[v] == -1) { DelaunayHull.Add(Site.Vtx[v]); } }
 			}
 
+			DelaunayOrder::SortUnique(DelaunayEdges);
+
 			Triangles.Empty();
 			Adjacencies.Empty();
 
 			return IsValid;
 		}
 
+		void RemoveLongestEdges(const TArrayView<FVector>& Positions, TArray<uint64>& OutLongestEdges)
+		{
+			OutLongestEdges.SetNumUninitialized(Sites.Num());
+			ParallelFor(Sites.Num(), [&](const int32 i) { GetLongestEdge(Positions, Sites[i].Vtx, OutLongestEdges[i]); });
+
+			DelaunayOrder::SortUnique(OutLongestEdges);
+			DelaunayOrder::RemoveSorted(DelaunayEdges, OutLongestEdges);
+		}
+
 		void RemoveLongestEdges(const TArrayView<FVector>& Positions)
 		{
-			uint64 Edge;
-			for (const FDelaunaySite2& Site : Sites)
-			{
-				GetLongestEdge(Positions, Site.Vtx, Edge);
-				DelaunayEdges.Remove(Edge);
-			}
+			TArray<uint64> LongestEdges;
+			RemoveLongestEdges(Positions, LongestEdges);
 		}
 
 		void RemoveLongestEdges(const TArrayView<FVector>& Positions, TSet<uint64>& LongestEdges)
 		{
-			uint64 Edge;
-			for (const FDelaunaySite2& Site : Sites)
-			{
-				GetLongestEdge(Positions, Site.Vtx, Edge);
-				DelaunayEdges.Remove(Edge);
-				LongestEdges.Add(Edge);
-			}
+			TArray<uint64> LongestEdgesList;
+			RemoveLongestEdges(Positions, LongestEdgesList);
+			LongestEdges.Append(LongestEdgesList);
 		}
 
 		void GetMergedSites(const int32 SiteIndex, const TSet<uint64>& EdgeConnectors, TSet<int32>& OutMerged, TSet<uint64>& OutUEdges, TBitArray<>& VisitedSites)
@@ -250,7 +383,7 @@ namespace PCGExGeo
 	public:
 		TArray<FDelaunaySite3> Sites;
 
-		TSet<uint64> DelaunayEdges;
+		TArray<uint64> DelaunayEdges; // Sorted, unique
 		TSet<int32> DelaunayHull;
 
 		bool IsValid = false;
@@ -275,17 +408,29 @@ namespace PCGExGeo
 			IsValid = false;
 		}
 
+		/** Points are inserted in DelaunayOrder; on degenerate input (e.g. grids), ties resolve according to that order rather than the input one. */
 		bool Process(const TArrayView<FVector>& Positions, const bool bComputeFaces = false)
 		{
 			Clear();
 			if (Positions.IsEmpty() || Positions.Num() <= 3) { return false; }
 
+			TArray<int32> Order;
+			DelaunayOrder::Sort(Positions, Order);
+
 			UE::Geometry::FDelaunay3 Tetrahedralization;
 
-			if (!Tetrahedralization.Triangulate(Positions))
 			{
-				Clear();
-				return false;
+				TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay3D::Triangulate);
+
+				TArray<FVector> OrderedPositions;
+				OrderedPositions.SetNumUninitialized(Order.Num());
+				for (int i = 0; i < Order.Num(); i++) { OrderedPositions[i] = Positions[Order[i]]; }
+
+				if (!Tetrahedralization.Triangulate(OrderedPositions))
+				{
+					Clear();
+					return false;
+				}
 			}
 
 			IsValid = true;
@@ -293,29 +438,36 @@ namespace PCGExGeo
 			TArray<FIntVector4> Tetrahedra = Tetrahedralization.GetTetrahedra();
 
 			const int32 NumSites = Tetrahedra.Num();
-			const int32 NumReserve = NumSites * 3;
-
-			DelaunayEdges.Reserve(NumReserve);
-
-			TMap<uint64, int32> Faces;
-			if (bComputeFaces) { Faces.Reserve(NumSites); }
 
 			PCGEx::InitArray(Sites, NumSites);
+			DelaunayEdges.SetNumUninitialized(NumSites * 6);
 
-			for (int i = 0; i < NumSites; i++)
-			{
-				FDelaunaySite3& Site = Sites[i] = FDelaunaySite3(Tetrahedra[i], i);
-
-				for (int a = 0; a < 4; a++)
+			ParallelFor(
+				NumSites, [&](const int32 i)
 				{
-					for (int b = a + 1; b < 4; b++)
+					FIntVector4& Tetrahedron = Tetrahedra[i];
+					for (int v = 0; v < 4; v++) { Tetrahedron[v] = Order[Tetrahedron[v]]; }
+
+					const FDelaunaySite3& Site = Sites[i] = FDelaunaySite3(Tetrahedron, i);
+
+					int32 EdgeIndex = i * 6;
+					for (int a = 0; a < 4; a++)
 					{
-						DelaunayEdges.Add(PCGEx::H64U(Site.Vtx[a], Site.Vtx[b]));
+						for (int b = a + 1; b < 4; b++) { DelaunayEdges[EdgeIndex++] = PCGEx::H64U(Site.Vtx[a], Site.Vtx[b]); }
 					}
-				}
+				});
 
-				if (bComputeFaces)
+			DelaunayOrder::SortUnique(DelaunayEdges);
+
+			TMap<uint64, int32> Faces;
+
+			if (bComputeFaces)
+			{
+				Faces.Reserve(NumSites);
+
+				for (int i = 0; i < NumSites; i++)
 				{
+					FDelaunaySite3& Site = Sites[i];
 					Site.ComputeFaces();
 
 					for (int f = 0; f < 4; f++)
@@ -354,25 +506,26 @@ namespace PCGExGeo
 			return IsValid;
 		}
 
+		void RemoveLongestEdges(const TArrayView<FVector>& Positions, TArray<uint64>& OutLongestEdges)
+		{
+			OutLongestEdges.SetNumUninitialized(Sites.Num());
+			ParallelFor(Sites.Num(), [&](const int32 i) { GetLongestEdge(Positions, Sites[i].Vtx, OutLongestEdges[i]); });
+
+			DelaunayOrder::SortUnique(OutLongestEdges);
+			DelaunayOrder::RemoveSorted(DelaunayEdges, OutLongestEdges);
+		}
+
 		void RemoveLongestEdges(const TArrayView<FVector>& Positions)
 		{
-			uint64 Edge;
-			for (const FDelaunaySite3& Site : Sites)
-			{
-				GetLongestEdge(Positions, Site.Vtx, Edge);
-				DelaunayEdges.Remove(Edge);
-			}
+			TArray<uint64> LongestEdges;
+			RemoveLongestEdges(Positions, LongestEdges);
 		}
 
 		void RemoveLongestEdges(const TArrayView<FVector>& Positions, TSet<uint64>& LongestEdges)
 		{
-			uint64 Edge;
-			for (const FDelaunaySite3& Site : Sites)
-			{
-				GetLongestEdge(Positions, Site.Vtx, Edge);
-				DelaunayEdges.Remove(Edge);
-				LongestEdges.Add(Edge);
-			}
+			TArray<uint64> LongestEdgesList;
+			RemoveLongestEdges(Positions, LongestEdgesList);
+			LongestEdges.Append(LongestEdgesList);
 		}
 	};
 }
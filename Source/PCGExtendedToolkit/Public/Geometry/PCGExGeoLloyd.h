@@ -0,0 +1,137 @@
+﻿// Copyright Timothé Lapetite 2024
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGExDetailsData.h"
+#include "Async/ParallelFor.h"
+
+namespace PCGExGeo
+{
+	/**
+	 * Delaunay cells flattened for Lloyd relaxation, kept alive across iterations.
+	 * Cells are indexed per point (CSR) so centroids can be gathered point by point, in parallel and without atomics.
+	 * The triangulation only needs rebuilding once points have drifted far enough from where they were when it was built
+	 * for its topology to likely be stale; in between, iterations re-evaluate centroids on the existing cells.
+	 */
+	template <int32 NUM_VTX>
+	class /*PCGEXTENDEDTOOLKIT_API*/ TLloydCells
+	{
+		TArray<int32> CellVtx; // NUM_VTX entries per cell
+		TArray<int32> PointCellsStart; // NumPoints + 1 entries
+		TArray<int32> PointCells;
+		TArray<FVector> ReferencePositions; // Positions the cells were built from
+		double RebuildDistanceSquared = 0;
+
+		TArray<FVector> CellCentroids;
+		TArray<double> Displacements;
+
+	public:
+		TLloydCells()
+		{
+		}
+
+		FORCEINLINE int32 NumCells() const { return CellVtx.Num() / NUM_VTX; }
+
+		/**
+		 * @param RebuildFactor Fraction of the average edge length a point may drift before the cells are considered stale. 0 always rebuilds.
+		 */
+		template <typename TSite>
+		void Build(const TArray<TSite>& Sites, const TArray<uint64>& Edges, const TArray<FVector>& Positions, const double RebuildFactor)
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(PCGExGeo::TLloydCells::Build);
+
+			const int32 NumPoints = Positions.Num();
+			const int32 NumSites = Sites.Num();
+
+			CellVtx.SetNumUninitialized(NumSites * NUM_VTX);
+			PointCellsStart.Init(0, NumPoints + 1);
+
+			for (int i = 0; i < NumSites; i++)
+			{
+				for (int v = 0; v < NUM_VTX; v++)
+				{
+					const int32 Vtx = Sites[i].Vtx[v];
+					CellVtx[i * NUM_VTX + v] = Vtx;
+					PointCellsStart[Vtx + 1]++;
+				}
+			}
+
+			for (int i = 0; i < NumPoints; i++) { PointCellsStart[i + 1] += PointCellsStart[i]; }
+
+			TArray<int32> Cursor;
+			Cursor.Append(PointCellsStart.GetData(), NumPoints);
+
+			PointCells.SetNumUninitialized(CellVtx.Num());
+			for (int i = 0; i < CellVtx.Num(); i++) { PointCells[Cursor[CellVtx[i]]++] = i / NUM_VTX; }
+
+			ReferencePositions = Positions;
+
+			RebuildDistanceSquared = 0;
+			if (RebuildFactor > 0 && !Edges.IsEmpty())
+			{
+				double TotalLength = 0;
+				for (const uint64 Edge : Edges) { TotalLength += FVector::Dist(Positions[PCGEx::H64A(Edge)], Positions[PCGEx::H64B(Edge)]); }
+				RebuildDistanceSquared = FMath::Square(TotalLength / Edges.Num() * RebuildFactor);
+			}
+		}
+
+		bool NeedsRebuild(const TArray<FVector>& Positions) const
+		{
+			if (CellVtx.IsEmpty() || RebuildDistanceSquared <= 0 || ReferencePositions.Num() != Positions.Num()) { return true; }
+
+			for (int i = 0; i < Positions.Num(); i++)
+			{
+				if (FVector::DistSquared(Positions[i], ReferencePositions[i]) > RebuildDistanceSquared) { return true; }
+			}
+
+			return false;
+		}
+
+		/**
+		 * Moves every point toward the average centroid of the cells it belongs to.
+		 * @return The largest squared distance any point moved by.
+		 */
+		double Relax(TArray<FVector>& Positions, const FPCGExInfluenceDetails& InfluenceDetails)
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(PCGExGeo::TLloydCells::Relax);
+
+			const int32 NumPoints = Positions.Num();
+			const int32 NumCellsLocal = NumCells();
+
+			CellCentroids.SetNumUninitialized(NumCellsLocal);
+			Displacements.SetNumUninitialized(NumPoints);
+
+			ParallelFor(
+				NumCellsLocal, [&](const int32 CellIndex)
+				{
+					FVector Centroid = FVector::ZeroVector;
+					for (int v = 0; v < NUM_VTX; v++) { Centroid += Positions[CellVtx[CellIndex * NUM_VTX + v]]; }
+					CellCentroids[CellIndex] = Centroid / NUM_VTX;
+				});
+
+			// Centroids are all computed from the previous positions, so each point can safely be moved in place
+			ParallelFor(
+				NumPoints, [&](const int32 Index)
+				{
+					FVector Sum = Positions[Index];
+					const int32 Start = PointCellsStart[Index];
+					const int32 End = PointCellsStart[Index + 1];
+					for (int i = Start; i < End; i++) { Sum += CellCentroids[PointCells[i]]; }
+
+					const FVector Target = Sum / (1 + End - Start);
+					const FVector NewPosition = InfluenceDetails.bProgressiveInfluence ?
+						                            FMath::Lerp(Positions[Index], Target, InfluenceDetails.GetInfluence(Index)) :
+						                            Target;
+
+					Displacements[Index] = FVector::DistSquared(Positions[Index], NewPosition);
+					Positions[Index] = NewPosition;
+				});
+
+			double MaxDisplacement = 0;
+			for (const double Displacement : Displacements) { MaxDisplacement = FMath::Max(MaxDisplacement, Displacement); }
+			return MaxDisplacement;
+		}
+	};
+}
@@ -0,0 +1,202 @@
+﻿// Copyright Timothé Lapetite 2024
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGPoint.h"
+
+#include <algorithm>
+
+namespace PCGExGeo
+{
+	/**
+	 * Static KD-tree over point locations, built once and queried concurrently.
+	 * Leaves own contiguous ranges of a permuted copy of the positions; every node keeps its tight bounds
+	 * so both nearest and farthest queries can prune whole subtrees. Queries never allocate.
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FPointKDTree
+	{
+		struct FTreeNode
+		{
+			FBox Bounds = FBox(ForceInit);
+			int32 Start = 0;
+			int32 End = 0;
+			int32 Left = -1;
+			int32 Right = -1;
+
+			FORCEINLINE bool IsLeaf() const { return Left == -1; }
+		};
+
+		static constexpr int32 LeafSize = 8;
+		static constexpr int32 MaxStack = 128; // Median splits keep depth under log2(N)
+
+		TArray<FTreeNode> Nodes;
+		TArray<int32> Indices;     // Original point index, permuted
+		TArray<FVector> Positions; // Positions, in leaf order once built
+
+		int32 BuildNode(const int32 Start, const int32 End)
+		{
+			// Positions are still in input order here; only Indices get partitioned
+			FBox Bounds(ForceInit);
+			for (int i = Start; i < End; i++) { Bounds += Positions[Indices[i]]; }
+
+			const int32 NodeIndex = Nodes.Emplace();
+			Nodes[NodeIndex].Bounds = Bounds;
+			Nodes[NodeIndex].Start = Start;
+			Nodes[NodeIndex].End = End;
+
+			if (End - Start <= LeafSize) { return NodeIndex; }
+
+			// Median split along the widest axis
+			const FVector Size = Bounds.GetSize();
+			const int32 Axis = Size.X >= Size.Y && Size.X >= Size.Z ? 0 : Size.Y >= Size.Z ? 1 : 2;
+			const int32 Mid = Start + (End - Start) / 2;
+
+			std::nth_element(
+				Indices.GetData() + Start, Indices.GetData() + Mid, Indices.GetData() + End,
+				[&](const int32 A, const int32 B) { return Positions[A][Axis] < Positions[B][Axis]; });
+
+			const int32 Left = BuildNode(Start, Mid);
+			const int32 Right = BuildNode(Mid, End);
+
+			Nodes[NodeIndex].Left = Left;
+			Nodes[NodeIndex].Right = Right;
+
+			return NodeIndex;
+		}
+
+		static FORCEINLINE double MaxDistSquared(const FBox& Box, const FVector& Position)
+		{
+			const FVector Far = FVector(
+				FMath::Max(FMath::Abs(Position.X - Box.Min.X), FMath::Abs(Position.X - Box.Max.X)),
+				FMath::Max(FMath::Abs(Position.Y - Box.Min.Y), FMath::Abs(Position.Y - Box.Max.Y)),
+				FMath::Max(FMath::Abs(Position.Z - Box.Min.Z), FMath::Abs(Position.Z - Box.Max.Z)));
+			return Far.SizeSquared();
+		}
+
+	public:
+		explicit FPointKDTree(const TArray<FPCGPoint>& InPoints)
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(PCGExGeo::FPointKDTree::Build);
+
+			const int32 NumPoints = InPoints.Num();
+			Indices.SetNumUninitialized(NumPoints);
+			Positions.SetNumUninitialized(NumPoints);
+
+			for (int i = 0; i < NumPoints; i++)
+			{
+				Indices[i] = i;
+				Positions[i] = InPoints[i].Transform.GetLocation();
+			}
+
+			if (NumPoints == 0) { return; }
+
+			Nodes.Reserve(2 * FMath::DivideAndRoundUp(NumPoints, LeafSize));
+			BuildNode(0, NumPoints);
+
+			// Lay positions out in leaf order so queries scan contiguous memory
+			TArray<FVector> LeafPositions;
+			LeafPositions.SetNumUninitialized(NumPoints);
+			for (int i = 0; i < NumPoints; i++) { LeafPositions[i] = Positions[Indices[i]]; }
+			Positions = MoveTemp(LeafPositions);
+		}
+
+		FORCEINLINE int32 Num() const { return Indices.Num(); }
+
+		/** Returns the index of the closest point, or -1 if the tree is empty. */
+		int32 FindNearest(const FVector& Position, double& OutDistSquared) const
+		{
+			OutDistSquared = MAX_dbl;
+			if (Nodes.IsEmpty()) { return -1; }
+
+			int32 Best = -1;
+			int32 Stack[MaxStack];
+			int32 StackSize = 0;
+			Stack[StackSize++] = 0;
+
+			while (StackSize > 0)
+			{
+				const FTreeNode& Node = Nodes[Stack[--StackSize]];
+				if (Node.Bounds.ComputeSquaredDistanceToPoint(Position) >= OutDistSquared) { continue; }
+
+				if (Node.IsLeaf())
+				{
+					for (int i = Node.Start; i < Node.End; i++)
+					{
+						const double Dist = FVector::DistSquared(Position, Positions[i]);
+						if (Dist < OutDistSquared)
+						{
+							OutDistSquared = Dist;
+							Best = Indices[i];
+						}
+					}
+					continue;
+				}
+
+				// Push the far child first so the near one is explored first and tightens the bound early
+				const double LeftDist = Nodes[Node.Left].Bounds.ComputeSquaredDistanceToPoint(Position);
+				const double RightDist = Nodes[Node.Right].Bounds.ComputeSquaredDistanceToPoint(Position);
+				if (LeftDist < RightDist)
+				{
+					Stack[StackSize++] = Node.Right;
+					Stack[StackSize++] = Node.Left;
+				}
+				else
+				{
+					Stack[StackSize++] = Node.Left;
+					Stack[StackSize++] = Node.Right;
+				}
+			}
+
+			return Best;
+		}
+
+		/** Returns the index of the farthest point, or -1 if the tree is empty. */
+		int32 FindFarthest(const FVector& Position, double& OutDistSquared) const
+		{
+			OutDistSquared = -1;
+			if (Nodes.IsEmpty()) { return -1; }
+
+			int32 Best = -1;
+			int32 Stack[MaxStack];
+			int32 StackSize = 0;
+			Stack[StackSize++] = 0;
+
+			while (StackSize > 0)
+			{
+				const FTreeNode& Node = Nodes[Stack[--StackSize]];
+				if (MaxDistSquared(Node.Bounds, Position) <= OutDistSquared) { continue; }
+
+				if (Node.IsLeaf())
+				{
+					for (int i = Node.Start; i < Node.End; i++)
+					{
+						const double Dist = FVector::DistSquared(Position, Positions[i]);
+						if (Dist > OutDistSquared)
+						{
+							OutDistSquared = Dist;
+							Best = Indices[i];
+						}
+					}
+					continue;
+				}
+
+				const double LeftDist = MaxDistSquared(Nodes[Node.Left].Bounds, Position);
+				const double RightDist = MaxDistSquared(Nodes[Node.Right].Bounds, Position);
+				if (LeftDist > RightDist)
+				{
+					Stack[StackSize++] = Node.Right;
+					Stack[StackSize++] = Node.Left;
+				}
+				else
+				{
+					Stack[StackSize++] = Node.Left;
+					Stack[StackSize++] = Node.Right;
+				}
+			}
+
+			return Best;
+		}
+	};
+}
@@ -0,0 +1,313 @@
+﻿// Copyright Timothé Lapetite 2024
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/ParallelFor.h"
+#include "Data/PCGSplineData.h"
+
+#include <algorithm>
+
+namespace PCGExGeo
+{
+	/**
+	 * Static median-split BVH over a flat list of boxes, built once and queried concurrently.
+	 * Nearest queries are best-first : nodes are expanded closest-bounds first, and the search stops
+	 * as soon as the closest pending bounds are farther than the best item found so far.
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FBoxTree
+	{
+		struct FTreeNode
+		{
+			FBox Bounds = FBox(ForceInit);
+			int32 Start = 0;
+			int32 End = 0;
+			int32 Left = -1;
+			int32 Right = -1;
+
+			FORCEINLINE bool IsLeaf() const { return Left == -1; }
+		};
+
+		struct FCandidate
+		{
+			double DistSquared;
+			int32 NodeIndex;
+		};
+
+		static constexpr int32 LeafSize = 4;
+		static constexpr int32 MaxStack = 128; // Median splits keep depth under log2(N)
+
+		TArray<FTreeNode> Nodes;
+		TArray<int32> Items; // Original box index, permuted
+		TArray<FBox> Boxes;  // Boxes, in leaf order once built
+
+		int32 BuildNode(const int32 Start, const int32 End)
+		{
+			FBox Bounds(ForceInit);
+			for (int i = Start; i < End; i++) { Bounds += Boxes[Items[i]]; }
+
+			const int32 NodeIndex = Nodes.Emplace();
+			Nodes[NodeIndex].Bounds = Bounds;
+			Nodes[NodeIndex].Start = Start;
+			Nodes[NodeIndex].End = End;
+
+			if (End - Start <= LeafSize) { return NodeIndex; }
+
+			const FVector Size = Bounds.GetSize();
+			const int32 Axis = Size.X >= Size.Y && Size.X >= Size.Z ? 0 : Size.Y >= Size.Z ? 1 : 2;
+			const int32 Mid = Start + (End - Start) / 2;
+
+			std::nth_element(
+				Items.GetData() + Start, Items.GetData() + Mid, Items.GetData() + End,
+				[&](const int32 A, const int32 B) { return Boxes[A].GetCenter()[Axis] < Boxes[B].GetCenter()[Axis]; });
+
+			const int32 Left = BuildNode(Start, Mid);
+			const int32 Right = BuildNode(Mid, End);
+
+			Nodes[NodeIndex].Left = Left;
+			Nodes[NodeIndex].Right = Right;
+
+			return NodeIndex;
+		}
+
+	public:
+		FBoxTree()
+		{
+		}
+
+		void Build(TArray<FBox>&& InBoxes)
+		{
+			Boxes = MoveTemp(InBoxes);
+			Nodes.Reset();
+
+			const int32 NumBoxes = Boxes.Num();
+			Items.SetNumUninitialized(NumBoxes);
+			for (int i = 0; i < NumBoxes; i++) { Items[i] = i; }
+
+			if (NumBoxes == 0) { return; }
+
+			Nodes.Reserve(2 * FMath::DivideAndRoundUp(NumBoxes, LeafSize));
+			BuildNode(0, NumBoxes);
+
+			TArray<FBox> LeafBoxes;
+			LeafBoxes.SetNumUninitialized(NumBoxes);
+			for (int i = 0; i < NumBoxes; i++) { LeafBoxes[i] = Boxes[Items[i]]; }
+			Boxes = MoveTemp(LeafBoxes);
+		}
+
+		FORCEINLINE int32 Num() const { return Items.Num(); }
+		FORCEINLINE FBox GetBounds() const { return Nodes.IsEmpty() ? FBox(ForceInit) : Nodes[0].Bounds; }
+
+		/**
+		 * Best-first nearest search.
+		 * @param InOutDistSquared Current best distance; items whose bounds are not closer than it are skipped.
+		 * @param TestItem (const int32 Item, double& InOutDistSquared) Computes the exact distance to an item and lowers InOutDistSquared if it's closer.
+		 */
+		template <typename FTestItem>
+		void FindNearest(const FVector& Position, double& InOutDistSquared, FTestItem&& TestItem) const
+		{
+			if (Nodes.IsEmpty()) { return; }
+
+			TArray<FCandidate, TInlineAllocator<MaxStack>> Heap;
+			auto Closer = [](const FCandidate& A, const FCandidate& B) { return A.DistSquared < B.DistSquared; };
+
+			Heap.HeapPush(FCandidate{Nodes[0].Bounds.ComputeSquaredDistanceToPoint(Position), 0}, Closer);
+
+			while (!Heap.IsEmpty())
+			{
+				FCandidate Current;
+				Heap.HeapPop(Current, Closer, EAllowShrinking::No);
+
+				if (Current.DistSquared >= InOutDistSquared) { break; } // Nothing left can beat the best
+
+				const FTreeNode& Node = Nodes[Current.NodeIndex];
+
+				if (Node.IsLeaf())
+				{
+					for (int i = Node.Start; i < Node.End; i++)
+					{
+						if (Boxes[i].ComputeSquaredDistanceToPoint(Position) >= InOutDistSquared) { continue; }
+						TestItem(Items[i], InOutDistSquared);
+					}
+					continue;
+				}
+
+				Heap.HeapPush(FCandidate{Nodes[Node.Left].Bounds.ComputeSquaredDistanceToPoint(Position), Node.Left}, Closer);
+				Heap.HeapPush(FCandidate{Nodes[Node.Right].Bounds.ComputeSquaredDistanceToPoint(Position), Node.Right}, Closer);
+			}
+		}
+
+		/** Calls Visit(const int32 Item) for every item whose bounds are within range of Position. */
+		template <typename FVisit>
+		void ForEachWithin(const FVector& Position, const double RadiusSquared, FVisit&& Visit) const
+		{
+			if (Nodes.IsEmpty()) { return; }
+
+			int32 Stack[MaxStack];
+			int32 StackSize = 0;
+			Stack[StackSize++] = 0;
+
+			while (StackSize > 0)
+			{
+				const FTreeNode& Node = Nodes[Stack[--StackSize]];
+				if (Node.Bounds.ComputeSquaredDistanceToPoint(Position) > RadiusSquared) { continue; }
+
+				if (Node.IsLeaf())
+				{
+					for (int i = Node.Start; i < Node.End; i++)
+					{
+						if (Boxes[i].ComputeSquaredDistanceToPoint(Position) <= RadiusSquared) { Visit(Items[i]); }
+					}
+					continue;
+				}
+
+				Stack[StackSize++] = Node.Right;
+				Stack[StackSize++] = Node.Left;
+			}
+		}
+	};
+
+	/**
+	 * Two-level proximity index over a set of splines.
+	 * Each spline gets its own tree of segments, bounded by their bezier control hulls in spline space,
+	 * so closest-key solves only ever run on the segments that can actually hold the answer.
+	 * A top-level tree over world-space spline bounds prunes whole splines by range or by best distance.
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FSplineBVH
+	{
+		const TArray<FPCGSplineStruct>* Splines = nullptr;
+		TArray<FBoxTree> SegmentTrees; // One per spline, in spline space
+		FBoxTree SplineTree;           // World-space bounds of every spline with at least one point
+		TArray<int32> TreeSplines;     // SplineTree item -> spline index
+
+	public:
+		explicit FSplineBVH(const TArray<FPCGSplineStruct>& InSplines)
+			: Splines(&InSplines)
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(PCGExGeo::FSplineBVH::Build);
+
+			const int32 NumSplines = InSplines.Num();
+			SegmentTrees.SetNum(NumSplines);
+
+			TArray<FBox> SplineBounds;
+			SplineBounds.Init(FBox(ForceInit), NumSplines);
+
+			ParallelFor(
+				NumSplines, [&](const int32 SplineIndex)
+				{
+					const FPCGSplineStruct& Spline = InSplines[SplineIndex];
+					const TArray<FInterpCurvePoint<FVector>>& Points = Spline.SplineCurves.Position.Points;
+					const int32 NumPoints = Points.Num();
+					const int32 NumSegments = Spline.GetNumberOfSplineSegments();
+
+					TArray<FBox> SegmentBounds;
+					SegmentBounds.SetNumUninitialized(NumSegments);
+
+					FBox LocalBounds(ForceInit);
+					for (int i = 0; i < NumSegments; i++)
+					{
+						const FInterpCurvePoint<FVector>& From = Points[i];
+						const FInterpCurvePoint<FVector>& To = Points[(i + 1) % NumPoints];
+
+						// Tangents are expressed per unit of input key, so they're scaled by the key delta the curve evaluates the segment with.
+						// That's the loop key offset for the closing segment, since the first point's key isn't offset there.
+						const double KeyDelta = i + 1 < NumPoints ? To.InVal - From.InVal : Spline.SplineCurves.Position.LoopKeyOffset;
+
+						// Hermite tangents as bezier control points; the hull contains linear & constant segments as well
+						FBox Hull(ForceInit);
+						Hull += From.OutVal;
+						Hull += From.OutVal + From.LeaveTangent * (KeyDelta / 3);
+						Hull += To.OutVal - To.ArriveTangent * (KeyDelta / 3);
+						Hull += To.OutVal;
+
+						SegmentBounds[i] = Hull;
+						LocalBounds += Hull;
+					}
+
+					if (NumSegments == 0 && NumPoints > 0) { LocalBounds += Points[0].OutVal; }
+					if (LocalBounds.IsValid) { SplineBounds[SplineIndex] = LocalBounds.TransformBy(Spline.Transform); }
+
+					SegmentTrees[SplineIndex].Build(MoveTemp(SegmentBounds));
+				});
+
+			// Splines without points can't be sampled in world space; keep them out of the top-level tree
+			TArray<FBox> ValidBounds;
+			ValidBounds.Reserve(NumSplines);
+			TreeSplines.Reserve(NumSplines);
+
+			for (int i = 0; i < NumSplines; i++)
+			{
+				if (!SplineBounds[i].IsValid) { continue; }
+				ValidBounds.Add(SplineBounds[i]);
+				TreeSplines.Add(i);
+			}
+
+			SplineTree.Build(MoveTemp(ValidBounds));
+		}
+
+		FORCEINLINE int32 Num() const { return SegmentTrees.Num(); }
+
+		/** Same result as FPCGSplineStruct::FindInputKeyClosestToWorldLocation, minus the segments that can't be closest. */
+		double FindClosestKey(const int32 SplineIndex, const FVector& WorldPosition) const
+		{
+			const FPCGSplineStruct& Spline = (*Splines)[SplineIndex];
+			const FInterpCurveVector& Curve = Spline.SplineCurves.Position;
+
+			if (SegmentTrees[SplineIndex].Num() == 0) { return Curve.Points.IsEmpty() ? 0 : Curve.Points[0].InVal; }
+
+			const FVector LocalPosition = Spline.Transform.InverseTransformPosition(WorldPosition);
+
+			double BestDistSquared = MAX_dbl;
+			double BestKey = 0;
+
+			SegmentTrees[SplineIndex].FindNearest(
+				LocalPosition, BestDistSquared, [&](const int32 SegmentIndex, double& InOutDistSquared)
+				{
+					float DistSquared = 0;
+					const float Key = Curve.InaccurateFindNearestOnSegment(LocalPosition, SegmentIndex, DistSquared);
+					if (DistSquared < InOutDistSquared)
+					{
+						InOutDistSquared = DistSquared;
+						BestKey = Key;
+					}
+				});
+
+			return BestKey;
+		}
+
+		/**
+		 * Finds the spline whose closest sample is nearest to WorldPosition.
+		 * @return The spline index, or -1 if no spline can be sampled.
+		 */
+		int32 FindNearestSpline(const FVector& WorldPosition, double& OutKey) const
+		{
+			int32 BestSpline = -1;
+			double BestDistSquared = MAX_dbl;
+			OutKey = 0;
+
+			SplineTree.FindNearest(
+				WorldPosition, BestDistSquared, [&](const int32 Item, double& InOutDistSquared)
+				{
+					const int32 SplineIndex = TreeSplines[Item];
+					const double Key = FindClosestKey(SplineIndex, WorldPosition);
+					const double DistSquared = FVector::DistSquared(WorldPosition, (*Splines)[SplineIndex].GetLocationAtSplineInputKey(static_cast<float>(Key), ESplineCoordinateSpace::World));
+					if (DistSquared < InOutDistSquared)
+					{
+						InOutDistSquared = DistSquared;
+						BestSpline = SplineIndex;
+						OutKey = Key;
+					}
+				});
+
+			return BestSpline;
+		}
+
+		/** Calls Visit(const int32 SplineIndex) for every spline that has at least one point within range of WorldPosition. */
+		template <typename FVisit>
+		FORCEINLINE void ForEachSplineWithin(const FVector& WorldPosition, const double RadiusSquared, FVisit&& Visit) const
+		{
+			SplineTree.ForEachWithin(WorldPosition, RadiusSquared, [&](const int32 Item) { Visit(TreeSplines[Item]); });
+		}
+	};
+}
@@ -0,0 +1,84 @@
+﻿// Copyright Timothé Lapetite 2024
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FPCGContext;
+
+namespace PCGExData
+{
+	class FPointIO;
+}
+
+namespace PCGExCluster
+{
+	class FCluster;
+}
+
+namespace PCGExClusterCache
+{
+	struct /*PCGEXTENDEDTOOLKIT_API*/ FStats
+	{
+		int64 Hits = 0;
+		int64 Misses = 0;
+		int64 Insertions = 0;
+		int64 Evictions = 0;
+		int32 NumEntries = 0;
+		int64 UsedBytes = 0;
+		int64 BudgetBytes = 0;
+	};
+
+	/**
+	 * Content-keyed cache of built clusters, living across graph executions.
+	 * Cached clusters are pristine : consumers only ever get mirrors of them, the same way clusters bound to edges data are handled.
+	 * Lazily built structures (octrees, expanded nodes & edges) are harvested back from mirrors so later hits skip those too;
+	 * published clusters are never mutated, harvesting swaps in a replacement entry instead.
+	 * Entries are evicted least-recently-used first once the memory budget is exceeded.
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FCache : public TSharedFromThis<FCache>
+	{
+		struct FEntry
+		{
+			TSharedPtr<PCGExCluster::FCluster> Cluster;
+			int64 Bytes = 0;
+			uint64 LastUsed = 0;
+		};
+
+		mutable FRWLock CacheLock;
+		TMap<uint64, FEntry> Entries;
+		uint64 Tick = 0;
+		int64 UsedBytes = 0;
+		int64 BudgetBytes = 0;
+		FStats Stats;
+
+		void EvictUnsafe(const int64 InBudgetBytes);
+
+	public:
+		explicit FCache(const int64 InBudgetBytes)
+			: BudgetBytes(InBudgetBytes)
+		{
+		}
+
+		TSharedPtr<PCGExCluster::FCluster> Find(const uint64 Key);
+		void Add(const uint64 Key, const TSharedRef<PCGExCluster::FCluster>& InCluster);
+
+		/** Adopts structures a mirror built lazily, if it still shares its topology with the cached cluster. */
+		void Harvest(const uint64 Key, const TSharedRef<PCGExCluster::FCluster>& InMirror);
+
+		void SetBudget(const int64 InBudgetBytes);
+		void Empty();
+
+		FStats GetStats() const;
+	};
+
+	/** Hash of everything a cluster build reads : vtx transforms & bounds, vtx & edge endpoints, and build options. 0 if the data isn't cluster-ready. */
+	uint64 ComputeKey(const TSharedRef<PCGExData::FPointIO>& InVtxIO, const TSharedRef<PCGExData::FPointIO>& InEdgesIO, const bool bIsOneToOne);
+
+	/** Rough memory footprint of a cluster and whatever it has built so far. */
+	int64 EstimateSize(const PCGExCluster::FCluster& InCluster);
+
+	/** Persistent cache of the world the context executes in, if enabled. */
+	TSharedPtr<FCache> GetCache(const FPCGContext* InContext);
+}
@@ -21,6 +21,11 @@ namespace PCGExCluster
 	class FCluster;
 }
 
+namespace PCGExHeuristics
+{
+	class FLandmarks;
+}
+
 /**
  * 
  */
@@ -71,10 +76,15 @@ public:
 	virtual void SetBoundCluster(const TSharedPtr<PCGExCluster::FCluster>& InCluster);
 	const TSharedPtr<PCGExCluster::FCluster>& GetBoundCluster() const;
 
+	void SetBoundLandmarks(const TSharedPtr<PCGExHeuristics::FLandmarks>& InLandmarks);
+	const TSharedPtr<PCGExHeuristics::FLandmarks>& GetBoundLandmarks() const;
+
 	virtual void BeginDestroy() override;
 
 protected:
 	TSharedPtr<PCGExCluster::FCluster> Cluster;
+
+	TSharedPtr<PCGExHeuristics::FLandmarks> Landmarks;
 #if PCGEX_ENGINE_VERSION < 505
 	virtual UPCGSpatialData* CopyInternal() const override;
 #else
@@ -84,9 +84,6 @@ namespace PCGExRelaxClusters
 
 		FPCGExInfluenceDetails InfluenceDetails;
 
-		bool bBuildExpandedNodes = false;
-		TSharedPtr<TArray<PCGExCluster::FExpandedNode>> ExpandedNodes;
-
 	public:
 		FProcessor(const TSharedRef<PCGExData::FFacade>& InVtxDataFacade, const TSharedRef<PCGExData::FFacade>& InEdgeDataFacade)
 			: TClusterProcessor(InVtxDataFacade, InEdgeDataFacade)
@@ -98,9 +95,7 @@ namespace PCGExRelaxClusters
 		virtual TSharedPtr<PCGExCluster::FCluster> HandleCachedCluster(const TSharedRef<PCGExCluster::FCluster>& InClusterRef) override;
 		virtual bool Process(TSharedPtr<PCGExMT::FTaskManager> InAsyncManager) override;
 		void StartRelaxIteration();
-		virtual void ProcessSingleRangeIteration(const int32 Iteration, const int32 LoopIdx, const int32 Count) override;
 		virtual void ProcessSingleNode(const int32 Index, PCGExCluster::FNode& Node, const int32 LoopIdx, const int32 Count) override;
-		virtual void CompleteWork() override;
 		virtual void Write() override;
 	};
 
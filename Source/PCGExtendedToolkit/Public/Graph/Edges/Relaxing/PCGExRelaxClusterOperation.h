@@ -40,12 +40,11 @@ public:
 		Cluster = InCluster;
 	}
 
-	virtual void ProcessExpandedNode(const PCGExCluster::FExpandedNode& ExpandedNode)
+	virtual void ProcessNode(const int32 NodeIndex)
 	{
 	}
 
 	PCGExCluster::FCluster* Cluster = nullptr;
-	TArray<PCGExCluster::FExpandedNode>* ExpandedNodes = nullptr;
 	TArray<FVector>* ReadBuffer = nullptr;
 	TArray<FVector>* WriteBuffer = nullptr;
 
@@ -1,4 +1,4 @@
-// Copyright Timothé Lapetite 2024
+﻿// Copyright Timothé Lapetite 2024
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #pragma once
@@ -117,6 +117,80 @@ namespace PCGExCluster
 
 	class FCluster;
 
+	/**
+	 * Point index -> Node index lookup.
+	 * Vtx point indices are dense, so the default is a flat array sized to the vtx count (-1 for absent points);
+	 * a map is only used when the cluster is a genuinely sparse subset of its vtx.
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FNodeIndexLookup
+	{
+		bool bDense = true;
+		int32 NumEntries = 0;
+		TArray<int32> Dense;
+		TMap<int32, int32> Sparse;
+
+	public:
+		FNodeIndexLookup()
+		{
+		}
+
+		FNodeIndexLookup(const int32 InNumPoints, const int32 InExpectedNodes)
+		{
+			Init(InNumPoints, InExpectedNodes);
+		}
+
+		FORCEINLINE bool IsDense() const { return bDense; }
+		FORCEINLINE int32 Num() const { return NumEntries; }
+
+		void Init(const int32 InNumPoints, const int32 InExpectedNodes);
+
+		FORCEINLINE int32 operator[](const int32 PointIndex) const
+		{
+			if (bDense) { return *(Dense.GetData() + PointIndex); }
+			return Sparse[PointIndex];
+		}
+
+		FORCEINLINE const int32* Find(const int32 PointIndex) const
+		{
+			if (!bDense) { return Sparse.Find(PointIndex); }
+			if (!Dense.IsValidIndex(PointIndex)) { return nullptr; }
+			const int32* NodeIndex = Dense.GetData() + PointIndex;
+			return *NodeIndex == -1 ? nullptr : NodeIndex;
+		}
+
+		FORCEINLINE void Add(const int32 PointIndex, const int32 NodeIndex)
+		{
+			if (!bDense)
+			{
+				Sparse.Add(PointIndex, NodeIndex);
+				NumEntries = Sparse.Num();
+				return;
+			}
+
+			if (PointIndex >= Dense.Num())
+			{
+				const int32 PrevNum = Dense.Num();
+				Dense.SetNumUninitialized(PointIndex + 1);
+				for (int i = PrevNum; i < Dense.Num(); i++) { Dense[i] = -1; }
+			}
+
+			int32& Entry = Dense[PointIndex];
+			if (Entry == -1) { NumEntries++; }
+			Entry = NodeIndex;
+		}
+
+		void Reserve(const int32 InNum);
+		void Empty();
+		void Shrink();
+
+		template <typename FunctionType>
+		void ForEach(FunctionType&& Func) const
+		{
+			if (bDense) { for (int i = 0; i < Dense.Num(); i++) { if (Dense[i] != -1) { Func(i, Dense[i]); } } }
+			else { for (const TPair<int32, int32>& Pair : Sparse) { Func(Pair.Key, Pair.Value); } }
+		}
+	};
+
 	struct /*PCGEXTENDEDTOOLKIT_API*/ FNode : PCGExGraph::FNode
 	{
 		FNode(): PCGExGraph::FNode()
@@ -158,6 +232,33 @@ namespace PCGExCluster
 		FORCEINLINE void Add(const FNode& Neighbor, const int32 EdgeIndex) { Adjacency.Add(PCGEx::H64(Neighbor.NodeIndex, EdgeIndex)); }
 	};
 
+	/**
+	 * Compressed-sparse-row adjacency.
+	 * Neighbors of node N are packed contiguously in Links[Offsets[N]..Offsets[N+1]) as H64(NeighborNodeIndex, EdgeIndex),
+	 * so traversals walk a single flat array instead of hopping between per-node arrays.
+	 * This is a copy : FNode::Adjacency remains the cluster's storage, so it adds memory & build time and only pays off on traversal-heavy graphs.
+	 * Topology only : it never goes stale when positions change, and is shared as-is by clusters that share nodes.
+	 */
+	struct /*PCGEXTENDEDTOOLKIT_API*/ FAdjacencyCSR
+	{
+		TArray<int32> Offsets;
+		TArray<uint64> Links;
+
+		FAdjacencyCSR()
+		{
+		}
+
+		void Build(const TArray<FNode>& InNodes);
+
+		FORCEINLINE int32 NumNodes() const { return Offsets.Num() - 1; }
+		FORCEINLINE int32 NumNeighbors(const int32 NodeIndex) const { return *(Offsets.GetData() + NodeIndex + 1) - *(Offsets.GetData() + NodeIndex); }
+		FORCEINLINE TArrayView<const uint64> GetLinks(const int32 NodeIndex) const
+		{
+			const int32 Start = *(Offsets.GetData() + NodeIndex);
+			return MakeArrayView(Links.GetData() + Start, *(Offsets.GetData() + NodeIndex + 1) - Start);
+		}
+	};
+
 	struct /*PCGEXTENDEDTOOLKIT_API*/ FExpandedNeighbor
 	{
 		const FNode* Node;
@@ -200,7 +301,7 @@ namespace PCGExCluster
 		bool bIsOneToOne = false; // Whether the input data has a single set of edges for a single set of vtx
 
 		int32 ClusterID = -1;
-		TSharedPtr<TMap<int32, int32>> NodeIndexLookup; // Node index -> Point Index
+		TSharedPtr<FNodeIndexLookup> NodeIndexLookup; // Point index -> Node Index
 		//TMap<uint64, int32> EdgeIndexLookup;   // Edge Hash -> Edge Index
 		TSharedPtr<TArray<FNode>> Nodes;
 		TSharedPtr<TArray<FExpandedNode>> ExpandedNodes;
@@ -208,6 +309,7 @@ namespace PCGExCluster
 		TSharedPtr<TArray<PCGExGraph::FIndexedEdge>> Edges;
 		TSharedPtr<TArray<double>> EdgeLengths;
 		TArray<FVector> NodePositions;
+		TSharedPtr<FAdjacencyCSR> AdjacencyCSR;
 
 		FBox Bounds;
 
@@ -221,10 +323,18 @@ namespace PCGExCluster
 		TSharedPtr<ClusterItemOctree> EdgeOctree;
 
 		FCluster(const TSharedPtr<PCGExData::FPointIO>& InVtxIO, const TSharedPtr<PCGExData::FPointIO>& InEdgesIO);
+
+		/** Shallow copy : shares everything OtherCluster has built so far, and is bound to the same data. */
+		explicit FCluster(const FCluster& OtherCluster);
 		FCluster(const TSharedRef<FCluster>& OtherCluster,
 		         const TSharedPtr<PCGExData::FPointIO>& InVtxIO, const TSharedPtr<PCGExData::FPointIO>& InEdgesIO,
 		         bool bCopyNodes, bool bCopyEdges, bool bCopyLookup);
 
+		/** Transformed clone : shares OtherCluster's topology, only positions & bounds are its own. Position-derived structures are rebuilt on demand. */
+		FCluster(const TSharedRef<FCluster>& OtherCluster,
+		         const TSharedPtr<PCGExData::FPointIO>& InVtxIO, const TSharedPtr<PCGExData::FPointIO>& InEdgesIO,
+		         const FTransform& InTransform);
+
 		void ClearInheritedForChanges(const bool bClearOwned = false);
 		void WillModifyVtxIO(const bool bClearOwned = false);
 		void WillModifyVtxPositions(const bool bClearOwned = false);
@@ -247,6 +357,15 @@ namespace PCGExCluster
 		const TArray<int32>* GetVtxPointIndicesPtr();
 		TArrayView<const uint64> GetVtxPointScopesView();
 
+		TSharedPtr<FAdjacencyCSR> GetAdjacencyCSR();
+
+		/** Neighbors of a node as H64(NeighborNodeIndex, EdgeIndex), from the compact adjacency if it was built. */
+		FORCEINLINE TArrayView<const uint64> GetLinks(const int32 NodeIndex) const
+		{
+			if (const FAdjacencyCSR* CSR = AdjacencyCSR.Get()) { return CSR->GetLinks(NodeIndex); }
+			return MakeArrayView((Nodes->GetData() + NodeIndex)->Adjacency);
+		}
+
 		FORCEINLINE FVector GetPos(const FNode& InNode) const { return *(NodePositions.GetData() + InNode.NodeIndex); }
 		FORCEINLINE FVector GetPos(const FNode* InNode) const { return *(NodePositions.GetData() + InNode->NodeIndex); }
 		FORCEINLINE FVector GetPos(const int32 Index) const { return *(NodePositions.GetData() + Index); }
@@ -319,10 +438,10 @@ namespace PCGExCluster
 
 		FORCEINLINE FVector GetCentroid(const int32 NodeIndex) const
 		{
-			const FNode* Node = (Nodes->GetData() + NodeIndex);
+			const TArrayView<const uint64> Links = GetLinks(NodeIndex);
 			FVector Centroid = FVector::ZeroVector;
-			for (const uint64 AdjacencyHash : Node->Adjacency) { Centroid += GetPos(PCGEx::H64A(AdjacencyHash)); }
-			return Centroid / static_cast<double>(Node->Adjacency.Num());
+			for (const uint64 Link : Links) { Centroid += GetPos(PCGEx::H64A(Link)); }
+			return Centroid / static_cast<double>(Links.Num());
 		}
 
 		void GetValidEdges(TArray<PCGExGraph::FIndexedEdge>& OutValidEdges) const;
@@ -339,26 +458,24 @@ namespace PCGExCluster
 		void GrabNeighbors(const int32 NodeIndex, TArray<T>& OutNeighbors, const MakeFunc&& Make) const
 		{
 			FNode* Node = (Nodes->GetData() + NodeIndex);
-			PCGEx::InitArray(OutNeighbors, Node->Adjacency.Num());
-			for (int i = 0; i < Node->Adjacency.Num(); i++)
+			const TArrayView<const uint64> Links = GetLinks(NodeIndex);
+
+			PCGEx::InitArray(OutNeighbors, Links.Num());
+			for (int i = 0; i < Links.Num(); i++)
 			{
-				uint32 OtherNodeIndex;
-				uint32 EdgeIndex;
-				PCGEx::H64(Node->Adjacency[i], OtherNodeIndex, EdgeIndex);
-				OutNeighbors[i] = Make(Node, (Nodes->GetData() + OtherNodeIndex), (Edges->GetData() + EdgeIndex));
+				OutNeighbors[i] = Make(Node, (Nodes->GetData() + PCGEx::H64A(Links[i])), (Edges->GetData() + PCGEx::H64B(Links[i])));
 			}
 		}
 
 		template <typename T, class MakeFunc>
 		void GrabNeighbors(const FNode& Node, TArray<T>& OutNeighbors, const MakeFunc&& Make) const
 		{
-			PCGEx::InitArray(OutNeighbors, Node.Adjacency.Num());
-			for (int i = 0; i < Node.Adjacency.Num(); i++)
+			const TArrayView<const uint64> Links = GetLinks(Node.NodeIndex);
+
+			PCGEx::InitArray(OutNeighbors, Links.Num());
+			for (int i = 0; i < Links.Num(); i++)
 			{
-				uint32 OtherNodeIndex;
-				uint32 EdgeIndex;
-				PCGEx::H64(Node.Adjacency[i], OtherNodeIndex, EdgeIndex);
-				OutNeighbors[i] = Make((Nodes->GetData() + OtherNodeIndex), (Edges->GetData() + EdgeIndex));
+				OutNeighbors[i] = Make((Nodes->GetData() + PCGEx::H64A(Links[i])), (Edges->GetData() + PCGEx::H64B(Links[i])));
 			}
 		}
 
@@ -384,6 +501,7 @@ namespace PCGExCluster
 
 		void CreateVtxPointIndices();
 		void CreateVtxPointScopes();
+		void CreateAdjacencyCSR();
 	};
 
 	struct /*PCGEXTENDEDTOOLKIT_API*/ FExpandedNode
@@ -394,14 +512,14 @@ namespace PCGExCluster
 		FExpandedNode(const TSharedPtr<FCluster>& Cluster, const int32 InNodeIndex):
 			Node(Cluster->Nodes->GetData() + InNodeIndex)
 		{
-			const int32 NumNeighbors = Node->Adjacency.Num();
+			const TArrayView<const uint64> Links = Cluster->GetLinks(InNodeIndex);
 			const FVector Pos = Cluster->GetPos(InNodeIndex);
-			Neighbors.SetNum(NumNeighbors);
+			Neighbors.SetNum(Links.Num());
 			for (int i = 0; i < Neighbors.Num(); i++)
 			{
 				uint32 NodeIndex;
 				uint32 EdgeIndex;
-				PCGEx::H64(Node->Adjacency[i], NodeIndex, EdgeIndex);
+				PCGEx::H64(Links[i], NodeIndex, EdgeIndex);
 				Neighbors[i] = FExpandedNeighbor(
 					Cluster->Nodes->GetData() + NodeIndex, Cluster->Edges->GetData() + EdgeIndex,
 					(Cluster->GetPos(NodeIndex) - Pos).GetSafeNormal());
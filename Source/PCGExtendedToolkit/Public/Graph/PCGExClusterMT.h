@@ -9,6 +9,7 @@
 #include "PCGExGraph.h"
 #include "PCGExCluster.h"
 #include "Data/PCGExClusterData.h"
+#include "Data/PCGExClusterCache.h"
 #include "Data/PCGExData.h"
 
 
@@ -61,6 +62,9 @@ namespace PCGExClusterMT
 		bool bInlineProcessEdges = false;
 		bool bInlineProcessRange = false;
 
+		TSharedPtr<PCGExClusterCache::FCache> PersistentCache;
+		uint64 PersistentKey = 0;
+
 		int32 NumNodes = 0;
 		int32 NumEdges = 0;
 
@@ -120,6 +124,8 @@ namespace PCGExClusterMT
 
 		virtual ~FClusterProcessor()
 		{
+			// Hand whatever was lazily built on our mirror back to the persistent cache
+			if (PersistentCache && Cluster) { PersistentCache->Harvest(PersistentKey, Cluster.ToSharedRef()); }
 			PCGEX_LOG_DTR(FClusterProcessor)
 		}
 
@@ -140,13 +146,35 @@ namespace PCGExClusterMT
 
 			if (!Cluster)
 			{
-				Cluster = MakeShared<PCGExCluster::FCluster>(VtxDataFacade->Source, EdgeDataFacade->Source);
-				Cluster->bIsOneToOne = bIsOneToOne;
+				PersistentCache = PCGExClusterCache::GetCache(ExecutionContext);
+				if (PersistentCache)
+				{
+					PersistentKey = PCGExClusterCache::ComputeKey(VtxDataFacade->Source, EdgeDataFacade->Source, bIsOneToOne);
+					if (!PersistentKey) { PersistentCache.Reset(); }
+					else if (const TSharedPtr<PCGExCluster::FCluster> PersistentCluster = PersistentCache->Find(PersistentKey))
+					{
+						Cluster = HandleCachedCluster(PersistentCluster.ToSharedRef());
+					}
+				}
+			}
+
+			if (!Cluster)
+			{
+				TSharedPtr<PCGExCluster::FCluster> NewCluster = MakeShared<PCGExCluster::FCluster>(VtxDataFacade->Source, EdgeDataFacade->Source);
+				NewCluster->bIsOneToOne = bIsOneToOne;
 
-				if (!Cluster->BuildFrom(*EndpointsLookup, ExpectedAdjacency))
+				if (!NewCluster->BuildFrom(*EndpointsLookup, ExpectedAdjacency)) { return false; }
+
+				if (PersistentCache)
+				{
+					// The cache keeps the pristine build; we work on a mirror like any cached cluster consumer would
+					PersistentCache->Add(PersistentKey, NewCluster.ToSharedRef());
+					Cluster = HandleCachedCluster(NewCluster.ToSharedRef());
+					Cluster->bIsOneToOne = bIsOneToOne;
+				}
+				else
 				{
-					Cluster.Reset();
-					return false;
+					Cluster = NewCluster;
 				}
 			}
 
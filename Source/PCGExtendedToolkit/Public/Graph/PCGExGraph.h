@@ -395,8 +395,8 @@ namespace PCGExGraph
 	{
 		int64 Id = -1;
 		FGraph* ParentGraph = nullptr;
-		TSet<int32> Nodes;
-		TSet<int32> Edges;
+		TArray<int32> Nodes; // Sorted
+		TArray<int32> Edges; // Sorted
 		TSet<int32> EdgesInIOIndices;
 		TSharedPtr<PCGExData::FFacade> VtxDataFacade;
 		TSharedPtr<PCGExData::FFacade> EdgesDataFacade;
@@ -413,24 +413,123 @@ namespace PCGExGraph
 			PCGEX_LOG_DTR(FSubGraph)
 		}
 
-		FORCEINLINE void Add(const FIndexedEdge& Edge, FGraph* InGraph)
-		{
-			Nodes.Add(Edge.Start);
-			Nodes.Add(Edge.End);
-			Edges.Add(Edge.EdgeIndex);
-			if (Edge.IOIndex >= 0) { EdgesInIOIndices.Add(Edge.IOIndex); }
-		}
-
 		void Invalidate(FGraph* InGraph);
 		TSharedPtr<PCGExCluster::FCluster> CreateCluster(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager) const;
 		int32 GetFirstInIOIndex();
 	};
 
+	/**
+	 * Edge hash (H64U) -> edge index, spread over independently locked shards.
+	 * Producers only lock the shard owning the hash they're looking up, so deduplication doesn't funnel
+	 * every thread through the graph lock.
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FEdgeRegistry
+	{
+		struct FShard
+		{
+			mutable FRWLock Lock;
+			TMap<uint64, int32> Edges;
+		};
+
+		static constexpr int32 ShardBits = 5;
+		static constexpr int32 NumShards = 1 << ShardBits;
+		FShard Shards[NumShards];
+
+		// H64U keys are ordered by their larger index, mix them so neighboring edges land in different shards
+		FORCEINLINE FShard& GetShard(const uint64 Hash) { return Shards[PCGEx::M64(Hash) >> (64 - ShardBits)]; }
+		FORCEINLINE const FShard& GetShard(const uint64 Hash) const { return Shards[PCGEx::M64(Hash) >> (64 - ShardBits)]; }
+
+	public:
+		void Reserve(const int32 InNum)
+		{
+			const int32 PerShard = InNum / NumShards + 1;
+			for (FShard& Shard : Shards) { Shard.Edges.Reserve(PerShard); }
+		}
+
+		/** Registers the hash with a pending (-1) index. Returns false if it was already registered. */
+		FORCEINLINE bool Claim(const uint64 Hash)
+		{
+			FShard& Shard = GetShard(Hash);
+
+			{
+				FReadScopeLock ReadScopeLock(Shard.Lock);
+				if (Shard.Edges.Contains(Hash)) { return false; }
+			}
+
+			FWriteScopeLock WriteScopeLock(Shard.Lock);
+			const int32 Num = Shard.Edges.Num();
+			Shard.Edges.FindOrAdd(Hash, -1); // Someone else may have claimed it while we were waiting for the write lock
+			return Shard.Edges.Num() != Num;
+		}
+
+		FORCEINLINE void Set(const uint64 Hash, const int32 EdgeIndex)
+		{
+			FShard& Shard = GetShard(Hash);
+			FWriteScopeLock WriteScopeLock(Shard.Lock);
+			Shard.Edges.Add(Hash, EdgeIndex);
+		}
+
+		/** Returns the index of the existing edge, -1 if it is still pending or unknown. */
+		FORCEINLINE int32 Find(const uint64 Hash) const
+		{
+			const FShard& Shard = GetShard(Hash);
+			FReadScopeLock ReadScopeLock(Shard.Lock);
+			const int32* EdgeIndex = Shard.Edges.Find(Hash);
+			return EdgeIndex ? *EdgeIndex : -1;
+		}
+
+		/** Returns the index of a registered edge, waiting on it if it is still pending. The hash must have been claimed. */
+		FORCEINLINE int32 Resolve(const uint64 Hash) const
+		{
+			int32 EdgeIndex = Find(Hash);
+			while (EdgeIndex == -1)
+			{
+				// The claimer only has to append the edge, this is short-lived
+				FPlatformProcess::Yield();
+				EdgeIndex = Find(Hash);
+			}
+			return EdgeIndex;
+		}
+
+		/** Registers the hash with the given index. Returns true if it wasn't already registered. */
+		FORCEINLINE bool Add(const uint64 Hash, const int32 EdgeIndex)
+		{
+			FShard& Shard = GetShard(Hash);
+			FWriteScopeLock WriteScopeLock(Shard.Lock);
+			const int32 Num = Shard.Edges.Num();
+			Shard.Edges.FindOrAdd(Hash, EdgeIndex);
+			return Shard.Edges.Num() != Num;
+		}
+
+		FORCEINLINE bool AddUnsafe(const uint64 Hash, const int32 EdgeIndex)
+		{
+			FShard& Shard = GetShard(Hash);
+			const int32 Num = Shard.Edges.Num();
+			Shard.Edges.FindOrAdd(Hash, EdgeIndex);
+			return Shard.Edges.Num() != Num;
+		}
+	};
+
 	class /*PCGEXTENDEDTOOLKIT_API*/ FGraph
 	{
 		mutable FRWLock GraphLock;
 		const int32 NumEdgesReserve;
 
+		FEdgeRegistry EdgeRegistry;
+
+		// Edges appended through AppendUniqueEdges are registered lazily, the first time a deduplicating insert needs them
+		std::atomic<bool> bHasUnregisteredEdges{false};
+		int32 UnregisteredEdgesStart = -1;
+
+		void FlushEdgeRegistry();
+		void FlushEdgeRegistryUnsafe();
+
+		int32 AppendEdgeUnsafe(const int32 A, const int32 B, const int32 IOIndex);
+		int32 AppendEdgeUnsafe(const FIndexedEdge& Edge);
+
+		template <typename T>
+		void InsertHashedEdges(const T& InEdges, int32 InIOIndex);
+
 	public:
 		bool bBuildClusters = false;
 		bool bExpandClusters = false;
@@ -441,8 +540,6 @@ namespace PCGExGraph
 
 		TArray<FIndexedEdge> Edges;
 
-		TSet<uint64> UniqueEdges;
-
 		TArray<TSharedPtr<FSubGraph>> SubGraphs;
 
 		bool bWriteEdgePosition = true;
@@ -467,11 +564,12 @@ namespace PCGExGraph
 
 		void ReserveForEdges(const int32 UpcomingAdditionCount);
 
-		bool InsertEdgeUnsafe(int32 A, int32 B, FIndexedEdge& OutEdge, int32 IOIndex);
-		bool InsertEdge(const int32 A, const int32 B, FIndexedEdge& OutEdge, const int32 IOIndex = -1);
+		/** Inserts the edge if it doesn't exist yet. Returns the index of the edge that ends up in the graph, whether new or existing, and copies it into OutEdge. */
+		int32 InsertEdgeUnsafe(int32 A, int32 B, FIndexedEdge& OutEdge, int32 IOIndex);
+		int32 InsertEdge(const int32 A, const int32 B, FIndexedEdge& OutEdge, const int32 IOIndex = -1);
 
-		bool InsertEdgeUnsafe(const FIndexedEdge& Edge);
-		bool InsertEdge(const FIndexedEdge& Edge);
+		int32 InsertEdgeUnsafe(const FIndexedEdge& Edge);
+		int32 InsertEdge(const FIndexedEdge& Edge);
 
 		void InsertEdgesUnsafe(const TSet<uint64>& InEdges, int32 InIOIndex);
 		void InsertEdges(const TSet<uint64>& InEdges, int32 InIOIndex);
@@ -479,6 +577,13 @@ namespace PCGExGraph
 		void InsertEdges(const TArray<uint64>& InEdges, int32 InIOIndex);
 		int32 InsertEdges(const TArray<FIndexedEdge>& InEdges);
 
+		/**
+		 * Bulk insert that skips deduplication entirely.
+		 * InEdges must not contain duplicates, nor edges already in the graph. Sorted input keeps adjacency writes local.
+		 */
+		void AppendUniqueEdges(const TArray<uint64>& InEdges, int32 InIOIndex);
+		int32 AppendUniqueEdges(const TArray<FIndexedEdge>& InEdges);
+
 		FORCEINLINE FGraphNodeMetadata* FindNodeMetadata(const int32 NodeIndex) { return NodeMetadata.Find(NodeIndex); }
 		FORCEINLINE FGraphEdgeMetadata* FindEdgeMetadata(const int32 EdgeIndex) { return EdgeMetadata.Find(EdgeIndex); }
 		FORCEINLINE FGraphEdgeMetadata* FindRootEdgeMetadata(const int32 EdgeIndex)
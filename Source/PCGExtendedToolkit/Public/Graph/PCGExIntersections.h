@@ -212,8 +212,34 @@ namespace PCGExGraph
 
 	struct /*PCGEXTENDEDTOOLKIT_API*/ FUnionGraph
 	{
-		TMap<uint32, FUnionNode*> GridTree;
+	protected:
+		struct FGridCell
+		{
+			FUnionNode* Node = nullptr;
+			PCGExData::FUnionData* Union = nullptr;
+		};
+
+		// Grid cells are spread over independently locked shards, picked from the top bits of the 64-bit cell hash,
+		// so concurrent inserts only contend when they land in the same shard. Cells are keyed on their coordinates, hash collisions never merge them.
+		struct FGridShard
+		{
+			mutable FRWLock Lock;
+			TMap<FInt64Vector3, FGridCell> Cells;
+		};
+
+		static constexpr int32 GridShardBits = 6;
+		static constexpr int32 NumGridShards = 1 << GridShardBits;
+		FGridShard GridShards[NumGridShards];
 
+		FORCEINLINE FGridShard& GetGridShard(const FInt64Vector3& GridCell) { return GridShards[PCGEx::GH64(GridCell) >> (64 - GridShardBits)]; }
+
+		// Nodes are constructed in place inside fixed-size pages, which keeps them packed and their addresses stable
+		static constexpr int32 NodesPerPage = 1024;
+		TArray<FUnionNode*> NodePages;
+
+		FUnionNode* NewNode(const FPCGPoint& Point, const FVector& Origin, const int32 IOIndex, const int32 PointIndex);
+
+	public:
 		TSharedPtr<PCGExData::FUnionMetadata> PointsUnion;
 		TSharedPtr<PCGExData::FUnionMetadata> EdgesUnion;
 		TArray<FUnionNode*> Nodes;
@@ -246,7 +272,8 @@ namespace PCGExGraph
 
 		~FUnionGraph()
 		{
-			for (const FUnionNode* Node : Nodes) { delete Node; }
+			for (FUnionNode* Node : Nodes) { Node->~FUnionNode(); }
+			for (FUnionNode* Page : NodePages) { FMemory::Free(Page); }
 		}
 
 		int32 NumNodes() const { return PointsUnion->Num(); }
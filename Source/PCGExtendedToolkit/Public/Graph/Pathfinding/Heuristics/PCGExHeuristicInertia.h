@@ -48,7 +48,7 @@ public:
 		const PCGExCluster::FNode& Seed,
 		const PCGExCluster::FNode& Goal) const override
 	{
-		return FMath::Max(0, ScoreCurveObj->GetFloatValue(GlobalInertiaScore)) * ReferenceWeight;
+		return FMath::Max(0, ScoreLUT->Eval(GlobalInertiaScore)) * ReferenceWeight;
 	}
 
 	FORCEINLINE virtual double GetEdgeScore(
@@ -68,11 +68,11 @@ public:
 					Cluster->GetDir(PreviousNodeIndex, From.NodeIndex),
 					Cluster->GetDir(From.NodeIndex, To.NodeIndex));
 
-				return FMath::Max(0, ScoreCurveObj->GetFloatValue(PCGExMath::Remap(Dot, -1, 1, OutMin, OutMax))) * ReferenceWeight;
+				return FMath::Max(0, ScoreLUT->Eval(PCGExMath::Remap(Dot, -1, 1, OutMin, OutMax))) * ReferenceWeight;
 			}
 		}
 
-		return FMath::Max(0, ScoreCurveObj->GetFloatValue(FallbackInertiaScore)) * ReferenceWeight;
+		return FMath::Max(0, ScoreLUT->Eval(FallbackInertiaScore)) * ReferenceWeight;
 	}
 
 protected:
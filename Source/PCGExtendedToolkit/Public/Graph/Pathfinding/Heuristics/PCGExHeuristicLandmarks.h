@@ -0,0 +1,157 @@
+﻿// Copyright Timothé Lapetite 2024
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Graph/PCGExCluster.h"
+#include "UObject/Object.h"
+#include "PCGExHeuristicOperation.h"
+#include "PCGExHeuristicsFactoryProvider.h"
+#include "PCGExHeuristicLandmarks.generated.h"
+
+namespace PCGExHeuristics
+{
+	/**
+	 * Exact shortest-path costs from a handful of landmark nodes, given one cost per edge.
+	 * By the triangle inequality, |d(L, Goal) - d(L, From)| never overestimates the cost between From and Goal.
+	 * Tables are keyed on the edge costs they were built from, so they can be bound to the edges data and reused by downstream nodes.
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FLandmarks
+	{
+	public:
+		uint64 VtxUID = 0;
+		int32 NumNodes = 0;
+		int32 NumEdges = 0;
+		int32 NumLandmarks = 0;
+		uint64 CostHash = 0;
+
+		TArray<int32> LandmarkNodes;
+		TArray<double> Distances; // Node-major, NumLandmarks entries per node; -1 if unreachable
+
+		explicit FLandmarks(const uint64 InVtxUID)
+			: VtxUID(InVtxUID)
+		{
+		}
+
+		static uint64 HashCosts(const TArray<double>& InEdgeCosts);
+
+		bool IsValidWith(const uint64 InVtxUID, const PCGExCluster::FCluster* InCluster, const int32 InNumLandmarks, const uint64 InCostHash) const;
+		void Build(const PCGExCluster::FCluster* InCluster, const int32 InNumLandmarks, const TArray<double>& InEdgeCosts);
+
+		FORCEINLINE double GetLowerBound(const int32 FromIndex, const int32 GoalIndex) const
+		{
+			const double* From = Distances.GetData() + FromIndex * NumLandmarks;
+			const double* Goal = Distances.GetData() + GoalIndex * NumLandmarks;
+
+			double LowerBound = 0;
+			for (int i = 0; i < NumLandmarks; i++)
+			{
+				if (From[i] < 0 || Goal[i] < 0) { continue; }
+				LowerBound = FMath::Max(LowerBound, FMath::Abs(Goal[i] - From[i]));
+			}
+
+			return LowerBound;
+		}
+	};
+}
+
+USTRUCT(BlueprintType)
+struct /*PCGEXTENDEDTOOLKIT_API*/ FPCGExHeuristicConfigLandmarks : public FPCGExHeuristicConfigBase
+{
+	GENERATED_BODY()
+
+	FPCGExHeuristicConfigLandmarks() :
+		FPCGExHeuristicConfigBase()
+	{
+	}
+
+	/** Number of landmarks picked per cluster. More landmarks give tighter bounds at the cost of memory (8 bytes per node per landmark) and a longer one-time precompute. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, ClampMin=1, ClampMax=32))
+	int32 NumLandmarks = 8;
+};
+
+/**
+ * ALT heuristic : A*, Landmarks & Triangle inequality.
+ * Landmark costs are measured with the handler's static edge score (goal & travel dependent heuristics left out),
+ * and the bound is added to the f-score as-is. Adds no edge cost of its own; weight, score curve & invert are ignored.
+ */
+UCLASS(MinimalAPI, DisplayName = "Landmarks")
+class /*PCGEXTENDEDTOOLKIT_API*/ UPCGExHeuristicLandmarks : public UPCGExHeuristicOperation
+{
+	GENERATED_BODY()
+
+	friend class UPCGExHeuristicsFactoryLandmarks;
+
+public:
+	virtual void CompleteClusterPreparation(const PCGExHeuristics::THeuristicsHandler* InHandler) override;
+
+	FORCEINLINE virtual double GetGlobalScore(
+		const PCGExCluster::FNode& From,
+		const PCGExCluster::FNode& Seed,
+		const PCGExCluster::FNode& Goal) const override
+	{
+		return Landmarks->GetLowerBound(From.NodeIndex, Goal.NodeIndex);
+	}
+
+	FORCEINLINE virtual double GetEdgeScore(
+		const PCGExCluster::FNode& From,
+		const PCGExCluster::FNode& To,
+		const PCGExGraph::FIndexedEdge& Edge,
+		const PCGExCluster::FNode& Seed,
+		const PCGExCluster::FNode& Goal,
+		const TArray<uint64>* TravelStack) const override
+	{
+		return 0;
+	}
+
+	virtual void Cleanup() override
+	{
+		Landmarks.Reset();
+		Super::Cleanup();
+	}
+
+protected:
+	int32 NumLandmarks = 8;
+	TSharedPtr<PCGExHeuristics::FLandmarks> Landmarks;
+
+	void BuildLandmarks(const uint64 InVtxUID, const TArray<double>& InEdgeCosts);
+};
+
+////
+
+UCLASS(MinimalAPI, BlueprintType, ClassGroup = (Procedural), Category="PCGEx|Data")
+class /*PCGEXTENDEDTOOLKIT_API*/ UPCGExHeuristicsFactoryLandmarks : public UPCGExHeuristicsFactoryBase
+{
+	GENERATED_BODY()
+
+public:
+	FPCGExHeuristicConfigLandmarks Config;
+
+	virtual UPCGExHeuristicOperation* CreateOperation(FPCGExContext* InContext) const override;
+};
+
+UCLASS(MinimalAPI, BlueprintType, ClassGroup = (Procedural), Category="PCGEx|Graph|Params")
+class /*PCGEXTENDEDTOOLKIT_API*/ UPCGExHeuristicsLandmarksProviderSettings : public UPCGExHeuristicsFactoryProviderSettings
+{
+	GENERATED_BODY()
+
+public:
+	//~Begin UPCGSettings
+#if WITH_EDITOR
+	PCGEX_NODE_INFOS_CUSTOM_SUBTITLE(
+		HeuristicsLandmarks, "Heuristics : Landmarks", "Heuristics based on precomputed shortest distances to landmark nodes (ALT).",
+		FName(GetDisplayName()))
+#endif
+	//~End UPCGSettings
+
+	/** Filter Config.*/
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, ShowOnlyInnerProperties))
+	FPCGExHeuristicConfigLandmarks Config;
+
+	virtual UPCGExParamFactoryBase* CreateFactory(FPCGExContext* InContext, UPCGExParamFactoryBase* InFactory) const override;
+
+#if WITH_EDITOR
+	virtual FString GetDisplayName() const override;
+#endif
+};
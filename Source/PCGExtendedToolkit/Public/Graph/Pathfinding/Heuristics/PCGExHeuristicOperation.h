@@ -5,10 +5,16 @@
 
 #include "CoreMinimal.h"
 #include "PCGExOperation.h"
+#include "PCGExCurveLUT.h"
 #include "Graph/PCGExCluster.h"
 #include "UObject/Object.h"
 #include "PCGExHeuristicOperation.generated.h"
 
+namespace PCGExHeuristics
+{
+	class THeuristicsHandler;
+}
+
 /**
  * 
  */
@@ -27,11 +33,23 @@ public:
 
 	UPROPERTY(Transient)
 	TObjectPtr<UCurveFloat> ScoreCurveObj;
+	TSharedPtr<PCGEx::FCurveLUT> ScoreLUT;
 
 	bool bHasCustomLocalWeightMultiplier = false;
+	bool bGlobalScoreUsesSeed = false; // Whether GetGlobalScore reads the Seed node; drives global score bounds caching
+	bool bEdgeScoreUsesGoal = false;   // Whether GetEdgeScore reads the Goal node; prevents sharing a search tree across goals
+	bool bEdgeScoreUsesTravel = false; // Whether GetEdgeScore reads the travel stack; keeps it out of precomputed edge costs
+
+	/** GetGlobalScore is an admissible bound of the remaining cost, in handler edge score units. It is added to the f-score as-is rather than remapped, and the operation has no edge score nor weight. */
+	bool bGlobalScoreIsLowerBound = false;
 
 	virtual void PrepareForCluster(const PCGExCluster::FCluster* InCluster);
 
+	/** Called once the handler has prepared every operation for the current cluster, so its scores can be queried. */
+	virtual void CompleteClusterPreparation(const PCGExHeuristics::THeuristicsHandler* InHandler)
+	{
+	}
+
 	FORCEINLINE virtual double GetGlobalScore(
 		const PCGExCluster::FNode& From,
 		const PCGExCluster::FNode& Seed,
@@ -71,6 +89,6 @@ protected:
 
 	FORCEINLINE virtual double SampleCurve(const double InTime) const
 	{
-		return FMath::Max(0, ScoreCurveObj->GetFloatValue(bInvert ? 1 - InTime : InTime));
+		return FMath::Max(0, ScoreLUT->Eval(bInvert ? 1 - InTime : InTime));
 	}
 };
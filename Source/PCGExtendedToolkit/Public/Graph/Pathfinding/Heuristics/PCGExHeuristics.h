@@ -76,11 +76,17 @@ namespace PCGExHeuristics
 	{
 		FPCGExContext* ExecutionContext = nullptr;
 
+		mutable FRWLock GlobalScoreBoundsLock;
+		TMap<uint64, FVector2D> GlobalScoreBounds;
+		bool bGlobalScoreUsesSeed = false;
+		bool bEdgeScoreUsesGoal = false;
+
 	public:
 		TSharedPtr<PCGExData::FFacade> VtxDataFacade;
 		TSharedPtr<PCGExData::FFacade> EdgeDataFacade;
 
 		TArray<UPCGExHeuristicOperation*> Operations;
+		TArray<UPCGExHeuristicOperation*> LowerBoundOperations; // Kept out of Operations : no edge score, no weight, global score used as-is
 		TArray<UPCGExHeuristicFeedback*> Feedbacks;
 		TArray<TObjectPtr<const UPCGExHeuristicsFactoryBase>> LocalFeedbackFactories;
 
@@ -88,10 +94,14 @@ namespace PCGExHeuristics
 
 		double ReferenceWeight = 1;
 		double TotalStaticWeight = 0;
+		double LocalFeedbackWeight = 0;
 		bool bUseDynamicWeight = false;
 
 		bool HasGlobalFeedback() const { return !Feedbacks.IsEmpty(); };
 
+		/** Whether a single search tree can serve every goal of a given seed : edge scores must not depend on the goal, nor change between paths. */
+		bool CanShareSearchTree() const { return !bEdgeScoreUsesGoal && !HasGlobalFeedback(); }
+
 		explicit THeuristicsHandler(FPCGExContext* InContext, const TSharedPtr<PCGExData::FFacade>& InVtxDataFacade, const TSharedPtr<PCGExData::FFacade>& InEdgeDataFacade);
 		explicit THeuristicsHandler(FPCGExContext* InContext, const TSharedPtr<PCGExData::FFacade>& InVtxDataCache, const TSharedPtr<PCGExData::FFacade>& InEdgeDataCache, const TArray<TObjectPtr<const UPCGExHeuristicsFactoryBase>>& InFactories);
 		~THeuristicsHandler();
@@ -113,6 +123,46 @@ namespace PCGExHeuristics
 			return GScore / TotalStaticWeight;
 		}
 
+		/**
+		 * Min/Max of GetGlobalScore over every node of the current cluster, for a given seed/goal pair.
+		 * Cached per goal (or per seed/goal when an operation depends on the seed) for the lifetime of the cluster,
+		 * so only the first query toward a goal pays the full O(N) sweep. Never cached with global feedback, as scores drift.
+		 */
+		FVector2D GetGlobalScoreBounds(
+			const PCGExCluster::FNode& Seed,
+			const PCGExCluster::FNode& Goal);
+
+		/** Tightest admissible bound of the remaining path cost, in edge score units. Meant to be added to the f-score without remapping. */
+		FORCEINLINE double GetLowerBoundScore(
+			const PCGExCluster::FNode& From,
+			const PCGExCluster::FNode& Seed,
+			const PCGExCluster::FNode& Goal) const
+		{
+			double LowerBound = 0;
+			for (const UPCGExHeuristicOperation* Op : LowerBoundOperations) { LowerBound = FMath::Max(LowerBound, Op->GetGlobalScore(From, Seed, Goal)); }
+			return LowerBound;
+		}
+
+		/**
+		 * Share of GetEdgeScore that depends neither on the goal nor on the path travelled so far.
+		 * Weighted against every operation & local feedback, so it never exceeds what GetEdgeScore returns for that edge.
+		 */
+		FORCEINLINE double GetStaticEdgeScore(
+			const PCGExCluster::FNode& From,
+			const PCGExCluster::FNode& To,
+			const PCGExGraph::FIndexedEdge& Edge) const
+		{
+			double EScore = 0;
+			double Weight = LocalFeedbackWeight;
+			for (const UPCGExHeuristicOperation* Op : Operations)
+			{
+				Weight += bUseDynamicWeight ? Op->WeightFactor * Op->GetCustomWeightMultiplier(To.NodeIndex, Edge.PointIndex) : Op->WeightFactor;
+				if (Op->bEdgeScoreUsesGoal || Op->bEdgeScoreUsesTravel) { continue; }
+				EScore += Op->GetEdgeScore(From, To, Edge, From, To, nullptr);
+			}
+			return Weight > 0 ? EScore / Weight : 0;
+		}
+
 		FORCEINLINE double GetEdgeScore(
 			const PCGExCluster::FNode& From,
 			const PCGExCluster::FNode& To,
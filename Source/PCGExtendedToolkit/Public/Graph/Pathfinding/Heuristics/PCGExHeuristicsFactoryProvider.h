@@ -5,18 +5,21 @@
 
 #include "CoreMinimal.h"
 #include "PCGExPointsProcessor.h"
+#include "PCGExCurveLUT.h"
 
 #include "PCGExHeuristicsFactoryProvider.generated.h"
 
 #define PCGEX_FORWARD_HEURISTIC_FACTORY \
 	NewFactory->WeightFactor = Config.WeightFactor; \
 	NewFactory->Config = Config; \
-	PCGEX_LOAD_SOFTOBJECT(UCurveFloat, NewFactory->Config.ScoreCurve, NewFactory->Config.ScoreCurveObj, PCGEx::WeightDistributionLinear)
+	PCGEX_LOAD_SOFTOBJECT(UCurveFloat, NewFactory->Config.ScoreCurve, NewFactory->Config.ScoreCurveObj, PCGEx::WeightDistributionLinear) \
+	NewFactory->Config.ScoreLUT = MakeShared<PCGEx::FCurveLUT>(NewFactory->Config.ScoreCurveObj);
 
 #define PCGEX_FORWARD_HEURISTIC_CONFIG \
 	NewOperation->WeightFactor = Config.WeightFactor; \
 	NewOperation->bInvert = Config.bInvert; \
 	NewOperation->ScoreCurveObj = Config.ScoreCurveObj; \
+	NewOperation->ScoreLUT = Config.ScoreLUT; \
 	NewOperation->bUseLocalWeightMultiplier = Config.bUseLocalWeightMultiplier; \
 	NewOperation->LocalWeightMultiplierSource = Config.LocalWeightMultiplierSource; \
 	NewOperation->WeightMultiplierAttribute = Config.WeightMultiplierAttribute;
@@ -51,6 +54,7 @@ struct /*PCGEXTENDEDTOOLKIT_API*/ FPCGExHeuristicConfigBase
 
 	UPROPERTY(Transient)
 	TObjectPtr<UCurveFloat> ScoreCurveObj;
+	TSharedPtr<PCGEx::FCurveLUT> ScoreLUT;
 
 	/** Use a local attribute */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Local Weight", meta=(PCG_Overridable))
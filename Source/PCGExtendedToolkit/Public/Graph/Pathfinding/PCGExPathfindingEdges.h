@@ -95,6 +95,12 @@ public:
 	/** Whether or not to search for closest node using an octree. Depending on your dataset, enabling this may be either much faster, or slightly slower. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Performance", meta=(PCG_NotOverridable, AdvancedDisplay))
 	bool bUseOctreeSearch = false;
+
+	/** Group queries that start from the same seed node, and grow a single shortest-path tree per group to extract all of its goals at once.
+	 * Much faster when many paths share a seed. Groups are searched Dijkstra-style regardless of the selected search algorithm.
+	 * Ignored when heuristics can't share a search tree (global feedback, or goal-dependent edge scores such as Azimuth). */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Performance", meta=(PCG_NotOverridable, AdvancedDisplay))
+	bool bGroupQueriesBySeed = false;
 };
 
 
@@ -122,6 +128,18 @@ struct /*PCGEXTENDEDTOOLKIT_API*/ FPCGExPathfindingEdgesContext final : FPCGExEd
 		const UPCGExSearchOperation* SearchOperation,
 		const TSharedPtr<PCGExPathfinding::FPathQuery>& Query,
 		const TSharedPtr<PCGExHeuristics::THeuristicsHandler>& HeuristicsHandler);
+
+	void TryFindPaths(
+		const UPCGExSearchOperation* SearchOperation,
+		const int32 SeedNodeIndex,
+		const TArray<int32>& QueryIndices,
+		const TSharedPtr<PCGExHeuristics::THeuristicsHandler>& HeuristicsHandler);
+
+protected:
+	void BuildPath(
+		PCGExCluster::FCluster* Cluster,
+		const TSharedPtr<PCGExPathfinding::FPathQuery>& Query,
+		const TArray<int32>& Path);
 };
 
 class /*PCGEXTENDEDTOOLKIT_API*/ FPCGExPathfindingEdgesElement final : public FPCGExEdgesProcessorElement
@@ -161,6 +179,31 @@ namespace PCGExPathfindingEdge
 		virtual bool ExecuteTask(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager) override;
 	};
 
+	class /*PCGEXTENDEDTOOLKIT_API*/ FSampleClusterPathGroupTask final : public FPCGExPathfindingTask
+	{
+	public:
+		FSampleClusterPathGroupTask(const TSharedPtr<PCGExData::FPointIO>& InPointIO,
+		                            const UPCGExSearchOperation* InSearchOperation,
+		                            const TArray<TSharedPtr<PCGExPathfinding::FPathQuery>>* InQueries,
+		                            const TSharedPtr<PCGExHeuristics::THeuristicsHandler>& InHeuristics,
+		                            const int32 InSeedNodeIndex,
+		                            TArray<int32>&& InQueryIndices) :
+			FPCGExPathfindingTask(InPointIO, InQueries),
+			SearchOperation(InSearchOperation),
+			Heuristics(InHeuristics),
+			SeedNodeIndex(InSeedNodeIndex),
+			QueryIndices(MoveTemp(InQueryIndices))
+		{
+		}
+
+		const UPCGExSearchOperation* SearchOperation = nullptr;
+		TSharedPtr<PCGExHeuristics::THeuristicsHandler> Heuristics;
+		int32 SeedNodeIndex = -1;
+		TArray<int32> QueryIndices;
+
+		virtual bool ExecuteTask(const TSharedPtr<PCGExMT::FTaskManager>& AsyncManager) override;
+	};
+
 	class FProcessor final : public PCGExClusterMT::TClusterProcessor<FPCGExPathfindingEdgesContext, UPCGExPathfindingEdgesSettings>
 	{
 	public:
@@ -173,6 +216,8 @@ namespace PCGExPathfindingEdge
 
 		UPCGExSearchOperation* SearchOperation = nullptr;
 
+		void StartQueryGroups();
+
 		virtual bool Process(TSharedPtr<PCGExMT::FTaskManager> InAsyncManager) override;
 	};
 }
@@ -1,7 +1,6 @@
 ﻿#pragma once
 
-#include <queue>
-#include <vector>
+#include "CoreMinimal.h"
 
 namespace PCGExSearch
 {
@@ -29,11 +28,16 @@ namespace PCGExSearch
 		};
 
 	protected:
-		std::priority_queue<FScoredNode, std::vector<FScoredNode>, std::greater<FScoredNode>> InternalQueue;
+		TArray<FScoredNode> InternalQueue; // Min-heap, keeps its allocation across Reset
 
 	public:
 		TArray<double> Scores;
 
+		explicit TScoredQueue(const int32 Size)
+		{
+			PCGEx::InitArray(Scores, Size);
+		}
+
 		TScoredQueue(const int32 Size, const int32& Item, const double Score)
 		{
 			PCGEx::InitArray(Scores, Size);
@@ -42,24 +46,31 @@ namespace PCGExSearch
 
 		~TScoredQueue()
 		{
-			std::priority_queue<FScoredNode, std::vector<FScoredNode>, std::greater<FScoredNode>> EmptyQueue;
-			std::swap(InternalQueue, EmptyQueue);
+			InternalQueue.Empty();
+		}
+
+		/** Drop pending entries without releasing memory, and push a new root.
+		 * Scores are left as-is : stale values are never read since Dequeue only compares against entries pushed after the reset. */
+		FORCEINLINE void Reset(const int32& Item, const double Score)
+		{
+			InternalQueue.Reset();
+			Enqueue(Item, Score);
 		}
 
 		FORCEINLINE void Enqueue(const int32& Id, const double Score)
 		{
 			Scores[Id] = Score;
-			InternalQueue.push(FScoredNode(Id, Score));
+			InternalQueue.HeapPush(FScoredNode(Id, Score));
 		}
 
 		FORCEINLINE bool Dequeue(int32& Item, double& OutScore)
 		{
 			//TRACE_CPUPROFILER_EVENT_SCOPE(ScoredQueue::Dequeue);
 
-			while (!InternalQueue.empty())
+			while (!InternalQueue.IsEmpty())
 			{
-				const FScoredNode TopNode = InternalQueue.top();
-				InternalQueue.pop();
+				FScoredNode TopNode(-1, 0);
+				InternalQueue.HeapPop(TopNode, EAllowShrinking::No);
 
 				if (TopNode.Score == Scores[TopNode.Id])
 				{
@@ -72,4 +83,138 @@ namespace PCGExSearch
 			return false;
 		}
 	};
+
+	/**
+	 * Indexed 4-ary min-heap keyed by node index, with true decrease-key.
+	 * Unlike TScoredQueue, a node is never in the heap twice : re-enqueuing updates its position in place,
+	 * so the heap never outgrows the open set. Sized once per cluster, Reset is proportional to the open set only.
+	 */
+	class FIndexedScoredQueue
+	{
+	protected:
+		TArray<int32> Heap;      // Node indices
+		TArray<int32> Positions; // Node index -> position in Heap, -1 if not queued
+
+		FORCEINLINE void Place(const int32 Position, const int32 Id)
+		{
+			Heap[Position] = Id;
+			Positions[Id] = Position;
+		}
+
+		FORCEINLINE void SiftUp(int32 Position)
+		{
+			const int32 Id = Heap[Position];
+			const double Score = Scores[Id];
+
+			while (Position > 0)
+			{
+				const int32 ParentPosition = (Position - 1) >> 2;
+				const int32 ParentId = Heap[ParentPosition];
+				if (Scores[ParentId] <= Score) { break; }
+
+				Place(Position, ParentId);
+				Position = ParentPosition;
+			}
+
+			Place(Position, Id);
+		}
+
+		FORCEINLINE void SiftDown(int32 Position)
+		{
+			const int32 Num = Heap.Num();
+			const int32 Id = Heap[Position];
+			const double Score = Scores[Id];
+
+			while (true)
+			{
+				const int32 FirstChild = (Position << 2) + 1;
+				if (FirstChild >= Num) { break; }
+
+				int32 BestPosition = FirstChild;
+				double BestScore = Scores[Heap[FirstChild]];
+
+				const int32 LastChild = FMath::Min(FirstChild + 4, Num);
+				for (int32 Child = FirstChild + 1; Child < LastChild; Child++)
+				{
+					const double ChildScore = Scores[Heap[Child]];
+					if (ChildScore < BestScore)
+					{
+						BestScore = ChildScore;
+						BestPosition = Child;
+					}
+				}
+
+				if (BestScore >= Score) { break; }
+
+				Place(Position, Heap[BestPosition]);
+				Position = BestPosition;
+			}
+
+			Place(Position, Id);
+		}
+
+	public:
+		TArray<double> Scores; // Only meaningful for queued nodes
+
+		explicit FIndexedScoredQueue(const int32 Size)
+		{
+			PCGEx::InitArray(Scores, Size);
+			Positions.Init(-1, Size);
+			Heap.Reserve(Size);
+		}
+
+		FIndexedScoredQueue(const int32 Size, const int32& Item, const double Score)
+			: FIndexedScoredQueue(Size)
+		{
+			Enqueue(Item, Score);
+		}
+
+		FORCEINLINE bool IsEmpty() const { return Heap.IsEmpty(); }
+		FORCEINLINE bool Contains(const int32 Id) const { return Positions[Id] != -1; }
+
+		/** Drop pending entries without releasing memory, and push a new root. */
+		FORCEINLINE void Reset(const int32& Item, const double Score)
+		{
+			for (const int32 Id : Heap) { Positions[Id] = -1; }
+			Heap.Reset();
+			Enqueue(Item, Score);
+		}
+
+		/** Insert Id, or move it to its new rank if it is already queued. */
+		FORCEINLINE void Enqueue(const int32& Id, const double Score)
+		{
+			const int32 Position = Positions[Id];
+
+			if (Position == -1)
+			{
+				Scores[Id] = Score;
+				SiftUp(Heap.Add(Id));
+				return;
+			}
+
+			const double PreviousScore = Scores[Id];
+			Scores[Id] = Score;
+
+			if (Score < PreviousScore) { SiftUp(Position); }
+			else if (Score > PreviousScore) { SiftDown(Position); }
+		}
+
+		FORCEINLINE bool Dequeue(int32& Item, double& OutScore)
+		{
+			if (Heap.IsEmpty()) { return false; }
+
+			Item = Heap[0];
+			OutScore = Scores[Item];
+			Positions[Item] = -1;
+
+			const int32 Last = Heap.Pop(EAllowShrinking::No);
+			if (!Heap.IsEmpty())
+			{
+				Heap[0] = Last;
+				SiftDown(0);
+			}
+
+			return true;
+		}
+	};
 }
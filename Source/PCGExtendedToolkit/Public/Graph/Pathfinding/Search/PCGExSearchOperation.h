@@ -22,6 +22,11 @@ namespace PCGExCluster
 	class FCluster;
 }
 
+namespace PCGExSearch
+{
+	class FSearchWorkspacePool;
+}
+
 /**
  * 
  */
@@ -32,6 +37,7 @@ class /*PCGEXTENDEDTOOLKIT_API*/ UPCGExSearchOperation : public UPCGExOperation
 
 public:
 	PCGExCluster::FCluster* Cluster = nullptr;
+	TSharedPtr<PCGExSearch::FSearchWorkspacePool> WorkspacePool;
 
 	virtual void CopySettingsFrom(const UPCGExOperation* Other) override;
 
@@ -44,4 +50,17 @@ public:
 		const TSharedPtr<PCGExHeuristics::THeuristicsHandler>& Heuristics,
 		TArray<int32>& OutPath,
 		const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback = nullptr) const;
+
+	/**
+	 * Grow a single shortest-path tree from a seed node and extract one path per goal node from it.
+	 * Only valid when heuristics can share a search tree (see THeuristicsHandler::CanShareSearchTree).
+	 * OutPaths is index-matched with GoalNodeIndices; entries are left empty for invalid or unreachable goals.
+	 */
+	virtual void FindPaths(
+		const int32 SeedNodeIndex,
+		const TArray<int32>& GoalNodeIndices,
+		const TSharedPtr<PCGExHeuristics::THeuristicsHandler>& Heuristics,
+		TArray<TArray<int32>>& OutPaths) const;
+
+	virtual void Cleanup() override;
 };
@@ -0,0 +1,123 @@
+﻿// Copyright Timothé Lapetite 2024
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGExH.h"
+#include "PCGExHelpers.h"
+#include "PCGExScoredQueue.h"
+
+namespace PCGExSearch
+{
+	/**
+	 * Per-query search state, sized once for a cluster and reused across queries.
+	 * Reset is O(1) : each node is stamped with the generation it was last written in,
+	 * and anything carrying an older stamp reads as untouched.
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FSearchWorkspace
+	{
+		uint32 Generation = 0;
+		TArray<uint32> Touched; // Generation in which GScore/TravelStack were last written
+		TArray<uint32> Visited; // Generation in which the node was last closed
+
+	public:
+		const int32 NumNodes;
+
+		TArray<double> GScore;
+		TArray<uint64> TravelStack; // Only valid along chains written during the current generation
+		FIndexedScoredQueue ScoredQueue;
+
+		explicit FSearchWorkspace(const int32 InNumNodes)
+			: NumNodes(InNumNodes), ScoredQueue(InNumNodes)
+		{
+			PCGEx::InitArray(Touched, NumNodes);
+			PCGEx::InitArray(Visited, NumNodes);
+			PCGEx::InitArray(GScore, NumNodes);
+			PCGEx::InitArray(TravelStack, NumNodes);
+
+			FMemory::Memzero(Touched.GetData(), NumNodes * sizeof(uint32));
+			FMemory::Memzero(Visited.GetData(), NumNodes * sizeof(uint32));
+		}
+
+		/** Start a new query rooted at SeedIndex. */
+		FORCEINLINE void Reset(const int32 SeedIndex, const double SeedScore)
+		{
+			if (++Generation == 0)
+			{
+				// Wrapped around, stamps from 2^32 queries ago would alias the new generation
+				FMemory::Memzero(Touched.GetData(), NumNodes * sizeof(uint32));
+				FMemory::Memzero(Visited.GetData(), NumNodes * sizeof(uint32));
+				Generation = 1;
+			}
+
+			// Heuristics walk the TravelStack back until they hit -1, so the seed must terminate the chain
+			Set(SeedIndex, 0, PCGEx::NH64(-1, -1));
+			ScoredQueue.Reset(SeedIndex, SeedScore);
+		}
+
+		FORCEINLINE bool IsVisited(const int32 NodeIndex) const { return Visited[NodeIndex] == Generation; }
+		FORCEINLINE void SetVisited(const int32 NodeIndex) { Visited[NodeIndex] = Generation; }
+
+		FORCEINLINE double GetGScore(const int32 NodeIndex) const { return Touched[NodeIndex] == Generation ? GScore[NodeIndex] : -1; }
+		FORCEINLINE uint64 GetTravel(const int32 NodeIndex) const { return Touched[NodeIndex] == Generation ? TravelStack[NodeIndex] : PCGEx::NH64(-1, -1); }
+
+		FORCEINLINE void Set(const int32 NodeIndex, const double InGScore, const uint64 InTravel)
+		{
+			Touched[NodeIndex] = Generation;
+			GScore[NodeIndex] = InGScore;
+			TravelStack[NodeIndex] = InTravel;
+		}
+	};
+
+	/**
+	 * Thread-safe free-list of workspaces for a single cluster.
+	 * Concurrent queries each grab their own; the pool never grows beyond peak concurrency.
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FSearchWorkspacePool
+	{
+		mutable FRWLock PoolLock;
+		TArray<TSharedPtr<FSearchWorkspace>> Available;
+
+	public:
+		const int32 NumNodes;
+
+		explicit FSearchWorkspacePool(const int32 InNumNodes)
+			: NumNodes(InNumNodes)
+		{
+		}
+
+		TSharedPtr<FSearchWorkspace> Acquire()
+		{
+			{
+				FWriteScopeLock WriteScopeLock(PoolLock);
+				if (!Available.IsEmpty()) { return Available.Pop(EAllowShrinking::No); }
+			}
+
+			return MakeShared<FSearchWorkspace>(NumNodes);
+		}
+
+		void Release(const TSharedPtr<FSearchWorkspace>& InWorkspace)
+		{
+			FWriteScopeLock WriteScopeLock(PoolLock);
+			Available.Add(InWorkspace);
+		}
+	};
+
+	/** Hands a pooled workspace back on scope exit. */
+	struct /*PCGEXTENDEDTOOLKIT_API*/ FScopedWorkspace
+	{
+		const TSharedPtr<FSearchWorkspacePool> Pool;
+		const TSharedPtr<FSearchWorkspace> Workspace;
+
+		explicit FScopedWorkspace(const TSharedPtr<FSearchWorkspacePool>& InPool)
+			: Pool(InPool), Workspace(InPool->Acquire())
+		{
+		}
+
+		~FScopedWorkspace() { Pool->Release(Workspace); }
+
+		FSearchWorkspace* operator->() const { return Workspace.Get(); }
+		FSearchWorkspace& operator*() const { return *Workspace.Get(); }
+	};
+}
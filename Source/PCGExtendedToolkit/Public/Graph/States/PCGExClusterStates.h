@@ -110,6 +110,10 @@ namespace PCGExClusterStates
 			return true;
 		}
 
+		// Test writes flags, every index must go through it
+		using PCGExClusterFilter::FManager::TestScope;
+		virtual void TestScope(const int32 StartIndex, const int32 Count, uint64* InOutMask) override { TestScopePerIndex(StartIndex, Count, InOutMask); }
+
 	protected:
 		virtual void PostInitFilter(const FPCGContext* InContext, const TSharedPtr<PCGExPointFilter::FFilter>& InFilter) override;
 	};
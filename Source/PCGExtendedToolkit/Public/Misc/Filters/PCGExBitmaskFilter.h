@@ -92,6 +92,8 @@ namespace PCGExPointsFilter
 			return TypedFilterFactory->Config.bInvertResult ? !Result : Result;
 		}
 
+		virtual void TestScope(const int32 StartIndex, const int32 Count, uint64* InOutMask) const override;
+
 		virtual ~TBitmaskFilter() override
 		{
 			TypedFilterFactory = nullptr;
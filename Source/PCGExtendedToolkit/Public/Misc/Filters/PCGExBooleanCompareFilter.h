@@ -83,6 +83,8 @@ namespace PCGExPointsFilter
 			return TypedFilterFactory->Config.Comparison == EPCGExEquality::Equal ? A == B : A != B;
 		}
 
+		virtual void TestScope(const int32 StartIndex, const int32 Count, uint64* InOutMask) const override;
+
 		virtual ~FBooleanComparisonFilter() override
 		{
 		}
@@ -87,6 +87,8 @@ namespace PCGExPointsFilter
 			return PCGExCompare::Compare(TypedFilterFactory->Config.Comparison, A, B, TypedFilterFactory->Config.Tolerance);
 		}
 
+		virtual void TestScope(const int32 StartIndex, const int32 Count, uint64* InOutMask) const override;
+
 		virtual ~TNumericComparisonFilter() override
 		{
 		}
@@ -85,6 +85,8 @@ namespace PCGExPointsFilter
 			return FMath::IsWithinInclusive(OperandA->Read(PointIndex), RealMin, RealMax) ? !bInvert : bInvert;
 		}
 
+		virtual void TestScope(const int32 StartIndex, const int32 Count, uint64* InOutMask) const override;
+
 		virtual ~TWithinRangeFilter() override
 		{
 			TypedFilterFactory = nullptr;
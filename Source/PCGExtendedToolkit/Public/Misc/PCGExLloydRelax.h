@@ -8,6 +8,7 @@
 #include "PCGExGlobalSettings.h"
 
 #include "PCGExPointsProcessor.h"
+#include "Geometry/PCGExGeoLloyd.h"
 
 
 #include "PCGExLloydRelax.generated.h"
@@ -43,6 +44,14 @@ public:
 	/** Influence Settings*/
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
 	FPCGExInfluenceDetails InfluenceDetails;
+
+	/** Stop iterating early once no point moved further than this distance during an iteration. 0 always runs every iteration. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, ClampMin=0))
+	double ConvergenceThreshold = 0;
+
+	/** The triangulation is reused across iterations until a point drifted further than this fraction of the average edge length since it was built. 0 rebuilds it every iteration. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Performance", meta = (PCG_Overridable, ClampMin=0), AdvancedDisplay)
+	double RebuildThreshold = 0;
 };
 
 struct /*PCGEXTENDEDTOOLKIT_API*/ FPCGExLloydRelaxContext final : FPCGExPointsProcessorContext
@@ -71,6 +80,7 @@ namespace PCGExLloydRelax
 
 		FPCGExInfluenceDetails InfluenceDetails;
 		TArray<FVector> ActivePositions;
+		PCGExGeo::TLloydCells<4> Cells;
 
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade):
@@ -122,6 +122,36 @@ protected:
 
 namespace PCGExSortPoints
 {
+	/**
+	 * Sorts the points of a facade by a list of rules.
+	 * Rule values are read once into packed keys, quantized by each rule's tolerance : values that fall in the same tolerance step compare equal.
+	 * An index permutation is sorted over those keys, with a parallel radix sort for a single rule or a parallel merge sort for several,
+	 * then applied to the points in a single gather. Sorting is stable.
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FPointSorter
+	{
+	public:
+		EPCGExSortDirection SortDirection = EPCGExSortDirection::Ascending;
+
+		FPointSorter(const TSharedRef<PCGExData::FFacade>& InDataFacade, const TArray<FPCGExSortRuleConfig>& InRuleConfigs);
+
+		/** Grabs rule values. Returns false if none of the rules can be read. */
+		bool Init(FPCGExContext* InContext);
+
+		/** Sorted order of the facade's points, as indices into them. */
+		void SortIndices(TArray<int32>& OutOrder) const;
+
+		/** Reorders the facade's output points. */
+		void Sort() const;
+
+	protected:
+		TSharedRef<PCGExData::FFacade> DataFacade;
+		TArray<FPCGExSortRuleConfig> RuleConfigs;
+		TArray<FPCGExSortRule> Rules;
+
+		void BuildKeys(TArray<uint64>& OutKeys) const;
+	};
+
 	class FProcessor final : public PCGExPointsMT::FPointsProcessor
 	{
 	public:
@@ -10,6 +10,8 @@
 #include "PCGExHelpers.h"
 #include "Engine/StreamableManager.h"
 
+class UPCGManagedComponent;
+
 namespace PCGEx
 {
 	using AsyncState = uint64;
@@ -116,6 +118,7 @@ protected:
 
 public:
 	void AttachManageComponent(AActor* InParent, USceneComponent* InComponent, const FAttachmentTransformRules& AttachmentRules) const;
+	void AttachManageComponent(AActor* InParent, USceneComponent* InComponent, UPCGManagedComponent* InManagedComponent, const FAttachmentTransformRules& AttachmentRules) const;
 
 #pragma endregion
 
@@ -0,0 +1,94 @@
+﻿// Copyright Timothé Lapetite 2024
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Curves/CurveFloat.h"
+
+namespace PCGEx
+{
+	/**
+	 * UCurveFloat baked into a fixed-resolution lookup table over [0..1]; anything in there is a single lerp between two samples.
+	 * Times outside [0..1] fall back to the curve itself so extrapolation behaves exactly as authored.
+	 *
+	 * Tolerance : smooth cubic segments are off by at most max|f''| / (8 * Resolution^2), i.e. ~2e-6 * max|f''| at the default resolution.
+	 * Linear segments and kinks (broken tangents, linear/cubic junctions) are exact as long as their keys land on a sample;
+	 * curves with stepped keys, or with kinks & discontinuities in between samples, are not baked and always evaluate the curve.
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FCurveLUT
+	{
+		TArray<double> Samples; // Resolution + 1 samples, plus a trailing copy of the last one so Eval never needs to clamp
+		const UCurveFloat* Curve = nullptr;
+		double ToSample = 0;
+		bool bBaked = false;
+
+		static bool CanBake(const UCurveFloat* InCurve, const int32 Resolution)
+		{
+			const FRichCurve& RichCurve = InCurve->FloatCurve;
+			const TArray<FRichCurveKey>& Keys = RichCurve.GetConstRefOfKeys();
+
+			if (Keys.Num() < 2) { return true; } // Constant
+
+			// Extrapolation inside [0..1] must be smooth
+			if (Keys[0].Time > 0 && RichCurve.PreInfinityExtrap != RCCE_Constant && RichCurve.PreInfinityExtrap != RCCE_Linear) { return false; }
+			if (Keys.Last().Time < 1 && RichCurve.PostInfinityExtrap != RCCE_Constant && RichCurve.PostInfinityExtrap != RCCE_Linear) { return false; }
+
+			for (int i = 0; i < Keys.Num(); i++)
+			{
+				const FRichCurveKey& Key = Keys[i];
+
+				// Segment starting at this key
+				if (i < Keys.Num() - 1 && Key.Time < 1 && Keys[i + 1].Time > 0 &&
+					(Key.InterpMode == RCIM_Constant || Key.InterpMode == RCIM_None))
+				{
+					return false;
+				}
+
+				if (Key.Time <= 0 || Key.Time >= 1) { continue; }
+
+				const bool bSmooth =
+					i > 0 && i < Keys.Num() - 1 &&
+					Keys[i - 1].InterpMode == RCIM_Cubic && Key.InterpMode == RCIM_Cubic &&
+					Key.TangentMode != RCTM_Break;
+
+				if (bSmooth) { continue; }
+
+				const double Position = Key.Time * Resolution;
+				if (!FMath::IsNearlyEqual(Position, FMath::RoundToDouble(Position), UE_KINDA_SMALL_NUMBER)) { return false; }
+			}
+
+			return true;
+		}
+
+	public:
+		static constexpr int32 DefaultResolution = 256;
+
+		explicit FCurveLUT(const UCurveFloat* InCurve, const int32 Resolution = DefaultResolution)
+			: Curve(InCurve)
+		{
+			check(Curve);
+			check(Resolution > 0);
+
+			bBaked = CanBake(Curve, Resolution);
+			if (!bBaked) { return; }
+
+			ToSample = Resolution;
+
+			Samples.SetNumUninitialized(Resolution + 2);
+			for (int i = 0; i <= Resolution; i++) { Samples[i] = Curve->GetFloatValue(static_cast<double>(i) / Resolution); }
+			Samples[Resolution + 1] = Samples[Resolution];
+		}
+
+		FORCEINLINE double Eval(const double Time) const
+		{
+			// Also routes NaN to the curve
+			if (!bBaked || !(Time >= 0 && Time <= 1)) { return Curve->GetFloatValue(Time); }
+
+			const double Position = Time * ToSample;
+			const int32 Index = static_cast<int32>(Position);
+			const double* Sample = Samples.GetData() + Index;
+			return Sample[0] + (Sample[1] - Sample[0]) * (Position - Index);
+		}
+	};
+}
@@ -9,6 +9,7 @@
 #include "PCGExMacros.h"
 #include "PCGEx.h"
 #include "PCGExMath.h"
+#include "PCGExCurveLUT.h"
 #include "PCGExActorSelector.h"
 #include "PCGExContext.h"
 
@@ -116,6 +117,7 @@ struct /*PCGEXTENDEDTOOLKIT_API*/ FPCGExRemapDetails
 		RangeMethod(Other.RangeMethod),
 		Scale(Other.Scale),
 		RemapCurveObj(Other.RemapCurveObj),
+		RemapLUT(Other.RemapLUT),
 		TruncateOutput(Other.TruncateOutput),
 		PostTruncateScale(Other.PostTruncateScale)
 	{
@@ -164,6 +166,7 @@ struct /*PCGEXTENDEDTOOLKIT_API*/ FPCGExRemapDetails
 
 	UPROPERTY(Transient)
 	TObjectPtr<UCurveFloat> RemapCurveObj = nullptr;
+	TSharedPtr<PCGEx::FCurveLUT> RemapLUT;
 
 
 	/** Whether and how to truncate output value. */
@@ -177,11 +180,12 @@ struct /*PCGEXTENDEDTOOLKIT_API*/ FPCGExRemapDetails
 	void LoadCurve()
 	{
 		PCGEX_LOAD_SOFTOBJECT(UCurveFloat, RemapCurve, RemapCurveObj, PCGEx::WeightDistributionLinear)
+		RemapLUT = MakeShared<PCGEx::FCurveLUT>(RemapCurveObj);
 	}
 
 	FORCEINLINE double GetRemappedValue(const double Value) const
 	{
-		double OutValue = RemapCurveObj->GetFloatValue(PCGExMath::Remap(Value, InMin, InMax, 0, 1)) * Scale;
+		double OutValue = RemapLUT->Eval(PCGExMath::Remap(Value, InMin, InMax, 0, 1)) * Scale;
 		switch (TruncateOutput)
 		{
 		case EPCGExTruncateMode::Round:
@@ -402,7 +406,7 @@ struct /*PCGEXTENDEDTOOLKIT_API*/ FPCGExFuseDetails : public FPCGExSourceFuseDet
 
 	bool DoInlineInsertion() const { return FuseMethod == EPCGExFuseMethod::Octree && bInlineInsertion; }
 
-	FORCEINLINE uint32 GetGridKey(const FVector& Location) const { return PCGEx::GH(Location + VoxelGridOffset, CWTolerance); }
+	FORCEINLINE FInt64Vector3 GetGridCell(const FVector& Location) const { return PCGEx::I643(Location + VoxelGridOffset, CWTolerance); }
 	FORCEINLINE FBoxCenterAndExtent GetOctreeBox(const FVector& Location) const { return FBoxCenterAndExtent(Location, Tolerances); }
 
 	FORCEINLINE void GetCenters(const FPCGPoint& SourcePoint, const FPCGPoint& TargetPoint, FVector& OutSource, FVector& OutTarget) const
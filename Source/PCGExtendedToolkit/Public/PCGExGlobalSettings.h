@@ -53,6 +53,10 @@ public:
 	int32 ClusterDefaultBatchChunkSize = 256;
 	int32 GetClusterBatchChunkSize(const int32 In = -1) const { return In <= -1 ? ClusterDefaultBatchChunkSize : In; }
 
+	/** Build a compact (CSR) copy of each cluster' adjacency, walked by searches & relaxing instead of per-node arrays. Per-node adjacency is still built, so this trades extra memory & build time for faster traversals; only worth it for traversal-heavy graphs (pathfinding, relaxing). */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster")
+	bool bBuildAdjacencyCSR = false;
+
 	/** Allow caching of clusters */
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster")
 	bool bCacheClusters = true;
@@ -65,6 +69,14 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(EditCondition="bDefaultBuildAndCacheClusters&&bCacheClusters"))
 	bool bDefaultCacheExpandedClusters = false;
 
+	/** Keep built clusters alive across graph executions, keyed on the content of their vtx & edges. Unchanged clusters skip building entirely when the graph re-executes. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster")
+	bool bPersistentClusterCache = false;
+
+	/** Memory budget of the persistent cluster cache, in megabytes. Least recently used clusters are evicted first. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(EditCondition="bPersistentClusterCache", ClampMin=1))
+	int32 PersistentClusterCacheBudgetMB = 256;
+
 
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Points", meta=(ClampMin=1))
 	int32 SmallPointsSize = 256;
@@ -74,10 +86,34 @@ public:
 	int32 PointsDefaultBatchChunkSize = 256;
 	int32 GetPointsBatchChunkSize(const int32 In = -1) const { return In <= -1 ? PointsDefaultBatchChunkSize : In; }
 
+	/** Broadcasters on large inputs read values page by page on first access, instead of reading the whole attribute upfront. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Points")
+	bool bLazyBroadcasters = true;
+
+	/** Inputs with fewer points than this are always read upfront. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Points", meta=(EditCondition="bLazyBroadcasters", ClampMin=1))
+	int32 LazyBroadcasterMinPoints = 65536;
+
+	/** Share of a buffer's pages that may be read on demand. Past that, access is dense enough that the remaining pages are read in a single pass. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Points", meta=(EditCondition="bLazyBroadcasters", ClampMin=0, ClampMax=1))
+	double LazyBroadcasterResidencyBudget = 0.25;
+
+	/** Spline mesh nodes pick up the components they generated on their previous execution, and only re-initialize the segments that changed. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Components")
+	bool bReuseSplineMeshComponents = true;
+
+	/** Time spent registering generated components on each execution tick, in milliseconds. Whatever doesn't fit is carried over to the next tick. 0 registers everything at once. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Components", meta=(ClampMin=0))
+	double ComponentRegistrationBudgetMs = 5;
+
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Async")
 	EPCGExAsyncPriority DefaultWorkPriority = EPCGExAsyncPriority::Normal;
 	EPCGExAsyncPriority GetDefaultWorkPriority() const { return DefaultWorkPriority == EPCGExAsyncPriority::Default ? EPCGExAsyncPriority::Normal : DefaultWorkPriority; }
 
+	/** Dispatch parallel range loops to a fixed set of workers (one per core) that pull & steal sub-ranges, instead of one task per sub-range. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Async")
+	bool bUseWorkStealingRanges = true;
+
 	UPROPERTY(EditAnywhere, config, Category = "Blending|Attribute Types Defaults|Simple Types", meta=(DisplayName="Boolean"))
 	EPCGExDataBlendingTypeDefault DefaultBooleanBlendMode = EPCGExDataBlendingTypeDefault::Default;
 
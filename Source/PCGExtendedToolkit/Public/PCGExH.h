@@ -109,4 +109,20 @@ namespace PCGEx
 	FORCEINLINE static uint32 GH(const FVector& Seed, const FInt64Vector3& Tolerance) { return GetTypeHash(I643(Seed, Tolerance)); }
 
 	FORCEINLINE static uint32 GH(const FVector& Seed, const FVector& Tolerance) { return GetTypeHash(I643(Seed, Tolerance)); }
+
+	// Finalizer from SplitMix64, spreads every input bit over the whole output
+	FORCEINLINE static uint64 M64(uint64 H)
+	{
+		H = (H ^ (H >> 30)) * 0xBF58476D1CE4E5B9ull;
+		H = (H ^ (H >> 27)) * 0x94D049BB133111EBull;
+		return H ^ (H >> 31);
+	}
+
+	// 64-bit mixed grid hash. Spreads well but isn't collision-free : compare cell coordinates where uniqueness matters
+	FORCEINLINE static uint64 GH64(const FInt64Vector3& Seed)
+	{
+		return M64(M64(M64(static_cast<uint64>(Seed.X)) ^ static_cast<uint64>(Seed.Y)) ^ static_cast<uint64>(Seed.Z));
+	}
+
+	FORCEINLINE static uint64 GH64(const FVector& Seed, const FVector& Tolerance) { return GH64(I643(Seed, Tolerance)); }
 }
@@ -5,8 +5,12 @@
 
 #include <functional>
 #include <atomic>
+#include <algorithm>
 
 #include "PCGExMacros.h"
+#include "Algo/Sort.h"
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
 #include "PCGExGlobalSettings.h"
 #include "Data/PCGExPointIO.h"
 
@@ -73,10 +77,84 @@ namespace PCGExMT
 		return OutSubRanges.Num();
 	}
 
+	/**
+	 * Sorts chunks of the array in parallel, then merges them pairwise, each merge pass running in parallel too.
+	 * Falls back to a regular sort when the array is too small to be worth splitting.
+	 */
+	template <typename T, typename PredicateT = TLess<T>>
+	static void ParallelSort(TArray<T>& Array, PredicateT Predicate = PredicateT(), const int32 MinChunkSize = 16384)
+	{
+		const int32 Num = Array.Num();
+		const int32 NumChunks = FMath::Min(FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads()), Num / MinChunkSize);
+
+		if (NumChunks <= 1)
+		{
+			Algo::Sort(Array, Predicate);
+			return;
+		}
+
+		const int32 ChunkSize = FMath::DivideAndRoundUp(Num, NumChunks);
+
+		ParallelFor(
+			NumChunks, [&](const int32 ChunkIndex)
+			{
+				const int32 Start = ChunkIndex * ChunkSize;
+				Algo::Sort(MakeArrayView(Array.GetData() + Start, FMath::Min(ChunkSize, Num - Start)), Predicate);
+			});
+
+		TArray<T> Buffer;
+		Buffer.SetNumUninitialized(Num);
+
+		T* Source = Array.GetData();
+		T* Target = Buffer.GetData();
+
+		for (int32 Width = ChunkSize; Width < Num; Width *= 2)
+		{
+			ParallelFor(
+				FMath::DivideAndRoundUp(Num, 2 * Width), [&](const int32 MergeIndex)
+				{
+					const int32 Start = MergeIndex * 2 * Width;
+					const int32 Mid = FMath::Min(Start + Width, Num);
+					const int32 End = FMath::Min(Start + 2 * Width, Num);
+					std::merge(Source + Start, Source + Mid, Source + Mid, Source + End, Target + Start, Predicate);
+				});
+
+			Swap(Source, Target);
+		}
+
+		if (Source != Array.GetData()) { Array = MoveTemp(Buffer); }
+	}
+
 	class FPCGExTask;
 	class FTaskGroup;
 	class FGroupRangeCallbackTask;
 
+	/**
+	 * Fixed set of per-worker sub-range queues.
+	 * Each worker owns a contiguous slice of the scope table; the owner pops from the front
+	 * and idle workers steal from the back. Both ends live in a single packed atomic so
+	 * pop & steal are a single CAS, without locks.
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FWorkStealingRanges
+	{
+	public:
+		TArray<uint64> Scopes;
+		int32 NumWorkers = 0;
+		bool bPrepareOnly = false;
+
+		FWorkStealingRanges(TArray<uint64>&& InScopes, const int32 InNumWorkers, const bool bInPrepareOnly);
+
+		bool Pop(const int32 WorkerIndex, int32& OutScopeIndex);
+		bool Steal(const int32 WorkerIndex, int32& OutScopeIndex);
+
+		/** Returns true when the calling worker is the last one to retire */
+		FORCEINLINE bool RetireWorker() { return ActiveWorkers.fetch_sub(1, std::memory_order_acq_rel) == 1; }
+
+	protected:
+		TUniquePtr<std::atomic<uint64>[]> Queues; // H64(Begin, End)
+		std::atomic<int32> ActiveWorkers{0};
+	};
+
 	class /*PCGEXTENDEDTOOLKIT_API*/ FTaskManager : public TSharedFromThis<FTaskManager>
 	{
 		friend class FPCGExTask;
@@ -210,6 +288,7 @@ namespace PCGExMT
 		friend class FGroupRangeIterationTask;
 		friend class FGroupPrepareRangeInlineTask;
 		friend class FGroupRangeInlineIterationTask;
+		friend class FGroupRangeStealingTask;
 
 		FName GroupName = NAME_None;
 
@@ -229,9 +308,13 @@ namespace PCGExMT
 		using IterationRangeStartCallback = std::function<void(const int32, const int32, const int32)>;
 		IterationRangeStartCallback OnIterationRangeStartCallback;
 
+		/** Non-inlined range loops are scheduled over a fixed set of work-stealing workers rather than one task per range */
+		bool bWorkStealing = true;
+
 		explicit FTaskGroup(const TSharedPtr<FTaskManager>& InManager, const FName InGroupName):
 			GroupName(InGroupName), Manager(InManager)
 		{
+			bWorkStealing = GetDefault<UPCGExGlobalSettings>()->bUseWorkStealingRanges;
 			InManager->GrowNumStarted();
 		}
 
@@ -288,6 +371,8 @@ namespace PCGExMT
 		void PrepareRangeIteration(const int32 StartIndex, const int32 Count, const int32 LoopIdx) const;
 		void DoRangeIteration(const int32 StartIndex, const int32 Count, const int32 LoopIdx) const;
 
+		void StartStealingRanges(const int32 MaxItems, const int32 ChunkSize, const bool bPrepareOnly);
+
 		template <typename T, typename... Args>
 		void InternalStart(const bool bGrowNumStarted, const int32 TaskIndex, const TSharedPtr<PCGExData::FPointIO>& InPointsIO, Args&&... InArgs)
 		{
@@ -300,18 +385,20 @@ namespace PCGExMT
 			else { Manager->StartBackgroundTask<T>(ATask, TaskIndex); }
 		}
 
+		void StartInlineRanges(const int32 MaxItems, const int32 ChunkSize, const bool bPrepareOnly);
+
 		template <typename T>
-		void InternalStartInlineRange(const int32 Index, const int32 MaxItems, const int32 ChunkSize)
+		void InternalStartInlineRange(const TSharedPtr<TArray<uint64>>& InScopes)
 		{
-			check(MaxItems > 0);
+			check(!InScopes->IsEmpty());
 
-			FAsyncTask<T>* NextRange = new FAsyncTask<T>(nullptr);
-			NextRange->GetTask().GroupPtr = SharedThis(this);
-			NextRange->GetTask().MaxItems = MaxItems;
-			NextRange->GetTask().ChunkSize = FMath::Max(1, ChunkSize);
+			// A single long-lived task walks the whole scope table sequentially
+			FAsyncTask<T>* InlineRange = new FAsyncTask<T>(nullptr);
+			InlineRange->GetTask().GroupPtr = SharedThis(this);
+			InlineRange->GetTask().Scopes = InScopes;
 
-			if (Manager->ForceSync) { Manager->StartSynchronousTask<T>(NextRange, Index); }
-			else { Manager->StartBackgroundTask<T>(NextRange, Index); }
+			if (Manager->ForceSync) { Manager->StartSynchronousTask<T>(InlineRange, 0); }
+			else { Manager->StartBackgroundTask<T>(InlineRange, 0); }
 		}
 	};
 
@@ -409,6 +496,25 @@ namespace PCGExMT
 		virtual bool ExecuteTask(const TSharedPtr<FTaskManager>& AsyncManager) override;
 	};
 
+	class FGroupRangeStealingTask final : public FPCGExTask
+	{
+	public:
+		explicit FGroupRangeStealingTask(const TSharedPtr<PCGExData::FPointIO>& InPointIO,
+		                                 const TSharedPtr<FTaskGroup>& InGroup,
+		                                 const TSharedPtr<FWorkStealingRanges>& InRanges):
+			FPCGExTask(InPointIO),
+			OwnerGroup(InGroup),
+			Ranges(InRanges)
+		{
+		}
+
+		// Workers are not registered with the group (GroupPtr stays unset);
+		// the last worker to retire notifies the group once.
+		TWeakPtr<FTaskGroup> OwnerGroup;
+		TSharedPtr<FWorkStealingRanges> Ranges;
+		virtual bool ExecuteTask(const TSharedPtr<FTaskManager>& AsyncManager) override;
+	};
+
 	class FGroupPrepareRangeInlineTask final : public FPCGExTask
 	{
 	public:
@@ -417,8 +523,7 @@ namespace PCGExMT
 		{
 		}
 
-		int32 MaxItems = 0;
-		int32 ChunkSize = 0;
+		TSharedPtr<TArray<uint64>> Scopes;
 		virtual bool ExecuteTask(const TSharedPtr<FTaskManager>& AsyncManager) override;
 	};
 
@@ -430,8 +535,7 @@ namespace PCGExMT
 		{
 		}
 
-		int32 MaxItems = 0;
-		int32 ChunkSize = 0;
+		TSharedPtr<TArray<uint64>> Scopes;
 		virtual bool ExecuteTask(const TSharedPtr<FTaskManager>& AsyncManager) override;
 	};
 
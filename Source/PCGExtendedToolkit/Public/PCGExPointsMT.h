@@ -250,8 +250,7 @@ namespace PCGExPointsMT
 		{
 			if (PrimaryFilters)
 			{
-				const int32 MaxIndex = StartIndex + Count;
-				for (int i = StartIndex; i < MaxIndex; i++) { PointFilterCache[i] = PrimaryFilters->Test(i); }
+				PrimaryFilters->TestScope(StartIndex, Count, PointFilterCache);
 			}
 		}
 
@@ -113,7 +113,7 @@ namespace PCGExBlendPath
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager> InAsyncManager) override;
 		virtual void PrepareSingleLoopScopeForPoints(const uint32 StartIndex, const int32 Count) override;
-		virtual void ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const int32 LoopIdx, const int32 LoopCount) override;
+		virtual void ProcessPoints(const int32 StartIndex, const int32 Count, const int32 LoopIdx) override;
 		virtual void CompleteWork() override;
 	};
 }
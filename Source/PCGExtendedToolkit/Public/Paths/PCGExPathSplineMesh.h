@@ -6,6 +6,7 @@
 #include "CoreMinimal.h"
 #include "PCGExPathProcessor.h"
 #include "PCGExPaths.h"
+#include "PCGExSplineMeshPool.h"
 #include "PCGExPointsProcessor.h"
 #include "Collections/PCGExMeshCollection.h"
 
@@ -140,8 +141,10 @@ struct /*PCGEXTENDEDTOOLKIT_API*/ FPCGExPathSplineMeshContext final : FPCGExPath
 	virtual void RegisterAssetDependencies() override;
 
 	TSet<AActor*> NotifyActors;
+	TSharedPtr<PCGExPaths::FSplineMeshPool> SplineMeshPool;
 
 	TObjectPtr<UPCGExMeshCollection> MainCollection;
+	const PCGExAssetCollection::FCache* MainCollectionCache = nullptr;
 };
 
 class /*PCGEXTENDEDTOOLKIT_API*/ FPCGExPathSplineMeshElement final : public FPCGExPathProcessorElement
@@ -167,7 +170,6 @@ namespace PCGExPathSplineMesh
 		bool bOneMinusWeight = false;
 		bool bNormalizedWeight = false;
 
-		bool bIsPreviewMode = false;
 		bool bClosedLoop = false;
 		bool bApplyScaleToFit = false;
 		bool bUseTags = false;
@@ -6,6 +6,7 @@
 #include "CoreMinimal.h"
 #include "PCGExPathProcessor.h"
 #include "PCGExPaths.h"
+#include "PCGExSplineMeshPool.h"
 #include "PCGExPointsProcessor.h"
 #include "Collections/PCGExAssetLoader.h"
 #include "Collections/PCGExMeshCollection.h"
@@ -87,6 +88,7 @@ struct /*PCGEXTENDEDTOOLKIT_API*/ FPCGExPathSplineMeshSimpleContext final : FPCG
 	friend class FPCGExPathSplineMeshSimpleElement;
 
 	TSet<AActor*> NotifyActors;
+	TSharedPtr<PCGExPaths::FSplineMeshPool> SplineMeshPool;
 	TSharedPtr<PCGEx::TAssetLoader<UStaticMesh>> StaticMeshLoader;
 	
 };
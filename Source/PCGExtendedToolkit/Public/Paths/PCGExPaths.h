@@ -6,6 +6,7 @@
 #include "CoreMinimal.h"
 #include "Collections/PCGExMeshCollection.h"
 #include "Components/SplineMeshComponent.h"
+#include "Hash/CityHash.h"
 
 #include "PCGExPaths.generated.h"
 
@@ -290,6 +291,32 @@ namespace PCGExPaths
 			if (bSetMeshWithSettings) { ApplyMesh(Component); }
 		}
 
+		/** Hash of everything ApplySettings writes. Mesh excluded. */
+		uint64 ComputeHash(const uint64 Seed) const
+		{
+			// Field by field, params have padding
+			const double Values[] = {
+				Params.StartPos.X, Params.StartPos.Y, Params.StartPos.Z,
+				Params.StartTangent.X, Params.StartTangent.Y, Params.StartTangent.Z,
+				Params.StartScale.X, Params.StartScale.Y, Params.StartRoll,
+				Params.StartOffset.X, Params.StartOffset.Y,
+				Params.EndPos.X, Params.EndPos.Y, Params.EndPos.Z,
+				Params.EndTangent.X, Params.EndTangent.Y, Params.EndTangent.Z,
+				Params.EndScale.X, Params.EndScale.Y, Params.EndRoll,
+				Params.EndOffset.X, Params.EndOffset.Y,
+#if PCGEX_ENGINE_VERSION > 503
+				Params.NaniteClusterBoundsScale,
+#endif
+				UpVector.X, UpVector.Y, UpVector.Z};
+
+			uint32 TagsHash = 0;
+			for (const FName& Tag : Tags) { TagsHash = HashCombineFast(TagsHash, GetTypeHash(Tag)); }
+
+			const uint32 Flags = static_cast<uint32>(SplineMeshAxis) | (bSmoothInterpRollScale ? 1 << 8 : 0) | (bUseDegrees ? 1 << 9 : 0);
+
+			return CityHash64WithSeed(reinterpret_cast<const char*>(Values), sizeof(Values), Seed ^ PCGEx::H64(TagsHash, Flags));
+		}
+
 		bool ApplyMesh(USplineMeshComponent* Component) const
 		{
 			check(Component)
@@ -0,0 +1,97 @@
+﻿// Copyright Timothé Lapetite 2024
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGManagedResource.h"
+#include "Components/SplineMeshComponent.h"
+
+#include "PCGExSplineMeshPool.generated.h"
+
+struct FPCGExContext;
+struct FPCGExStaticMeshComponentDescriptor;
+
+/**
+ * Managed spline mesh that survives regeneration, so the node that generated it can pick it up on its next execution.
+ * Resetting leaves the component untouched; whatever isn't picked up again is cleaned up by PCG once the graph is done.
+ */
+UCLASS(BlueprintType)
+class /*PCGEXTENDEDTOOLKIT_API*/ UPCGExManagedSplineMeshComponent : public UPCGManagedComponent
+{
+	GENERATED_BODY()
+
+public:
+	//~Begin UPCGManagedComponent
+	virtual bool SupportsComponentReset() const override { return true; }
+	virtual void ResetComponent() override { }
+	//~End UPCGManagedComponent
+
+	/** Source component & node this was generated for. */
+	UPROPERTY()
+	uint32 PoolKey = 0;
+
+	/** Hash of the parameters the component was last initialized with. */
+	UPROPERTY()
+	uint64 SegmentHash = 0;
+
+	USplineMeshComponent* GetComponent() const { return Cast<USplineMeshComponent>(GeneratedComponent.Get()); }
+};
+
+namespace PCGExPaths
+{
+	/**
+	 * Spline mesh components of a single execution.
+	 * Components are named after their path & segment index, so a segment finds the component it generated last time by name alone;
+	 * if that one was initialized from the same parameters & mesh it is reused as-is, otherwise it is re-initialized in place.
+	 * Registration of new components is deferred to Drain, which only spends a fixed amount of time per tick.
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FSplineMeshPool : public TSharedFromThis<FSplineMeshPool>
+	{
+		struct FPending
+		{
+			TObjectPtr<USplineMeshComponent> Component;
+			TObjectPtr<AActor> Owner;
+			TObjectPtr<UPCGExManagedSplineMeshComponent> Resource; // Null if the component is new
+			uint64 Hash = 0;
+		};
+
+		FPCGExContext* Context = nullptr;
+		uint32 PoolKey = 0;
+		bool bTransient = false;
+
+		TMap<FName, TObjectPtr<UPCGExManagedSplineMeshComponent>> Available;
+		TMap<USplineMeshComponent*, TObjectPtr<UPCGExManagedSplineMeshComponent>> Claimed;
+		TMap<const FPCGExStaticMeshComponentDescriptor*, uint32> DescriptorHashes;
+
+		TArray<FPending> Pending;
+		int32 DrainIndex = 0;
+
+	public:
+		explicit FSplineMeshPool(FPCGExContext* InContext);
+
+		/** Base name of the components generated from a given path; segments are told apart by the name number. */
+		FName GetBaseName(const int32 InIOIndex) const;
+
+		/** Hash of a descriptor's values, cached per descriptor for the lifetime of the pool. Game thread only. */
+		uint32 GetDescriptorHash(const FPCGExStaticMeshComponentDescriptor& InDescriptor);
+
+		/**
+		 * Picks up the component that was generated under that name last time, or creates a new one. Game thread only.
+		 * @param bOutRequiresInit Whether the component must be initialized then committed. If false, it was generated from identical parameters and is already good to go.
+		 */
+		USplineMeshComponent* Acquire(AActor* InOwner, const FName InName, const uint64 InHash, const UStaticMesh* InMesh, bool& bOutRequiresInit);
+
+		/** Queues an initialized component for registration, or for a render state & collision refresh if it was reused. */
+		void Commit(USplineMeshComponent* InComponent, AActor* InOwner, const uint64 InHash);
+
+		/** Gives up on an acquired component that couldn't be initialized. */
+		void Discard(USplineMeshComponent* InComponent);
+
+		/**
+		 * Registers committed components until the per-tick budget is spent.
+		 * @return true once everything has been registered.
+		 */
+		bool Drain();
+	};
+}
@@ -11,6 +11,7 @@
 #include "Graph/PCGExCluster.h"
 #include "Graph/PCGExGraph.h"
 #include "PCGExOperation.h"
+#include "PCGExCurveLUT.h"
 
 
 #include "Graph/Filters/PCGExClusterFilter.h"
@@ -21,6 +22,7 @@
 #define PCGEX_SAMPLER_CREATE\
 	NewOperation->SamplingConfig = SamplingConfig; \
 	PCGEX_LOAD_SOFTOBJECT(UCurveFloat, NewOperation->SamplingConfig.WeightCurve, NewOperation->WeightCurveObj, PCGEx::WeightDistributionLinear) \
+	NewOperation->WeightLUT = MakeShared<PCGEx::FCurveLUT>(NewOperation->WeightCurveObj); \
 	NewOperation->PointFilterFactories.Append(PointFilterFactories); \
 	NewOperation->ValueFilterFactories.Append(ValueFilterFactories);
 
@@ -125,6 +127,7 @@ public:
 
 	UPROPERTY(Transient)
 	TObjectPtr<UCurveFloat> WeightCurveObj = nullptr;
+	TSharedPtr<PCGEx::FCurveLUT> WeightLUT;
 
 	virtual void CopySettingsFrom(const UPCGExOperation* Other) override;
 
@@ -163,7 +166,7 @@ protected:
 	bool bIsValidOperation = true;
 	TSharedPtr<PCGExCluster::FCluster> Cluster;
 
-	FORCEINLINE virtual double SampleCurve(const double InTime) const { return WeightCurveObj->GetFloatValue(InTime); }
+	FORCEINLINE virtual double SampleCurve(const double InTime) const { return WeightLUT->Eval(InTime); }
 };
 
 UCLASS(BlueprintType, ClassGroup = (Procedural), Category="PCGEx|Data")
@@ -273,6 +273,7 @@ struct /*PCGEXTENDEDTOOLKIT_API*/ FPCGExSampleNearestBoundsContext final : FPCGE
 	const TArray<FPCGPoint>* BoundsPoints = nullptr;
 
 	TObjectPtr<UCurveFloat> WeightCurve = nullptr;
+	TSharedPtr<PCGEx::FCurveLUT> WeightLUT;
 
 	PCGEX_FOREACH_FIELD_NEARESTBOUNDS(PCGEX_OUTPUT_DECL_TOGGLE)
 };
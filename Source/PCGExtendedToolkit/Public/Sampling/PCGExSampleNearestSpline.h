@@ -9,6 +9,7 @@
 #include "PCGExPointsProcessor.h"
 #include "PCGExSampling.h"
 #include "Data/PCGSplineData.h"
+#include "Geometry/PCGExGeoSplineBVH.h"
 
 
 #include "PCGExSampleNearestSpline.generated.h"
@@ -325,10 +326,12 @@ struct /*PCGEXTENDEDTOOLKIT_API*/ FPCGExSampleNearestSplineContext final : FPCGE
 	TArray<const UPCGSplineData*> Targets;
 	TArray<FPCGSplineStruct> Splines;
 	TArray<double> SegmentCounts;
+	TSharedPtr<PCGExGeo::FSplineBVH> SplineBVH;
 
 	int64 NumTargets = 0;
 
 	TObjectPtr<UCurveFloat> WeightCurve = nullptr;
+	TSharedPtr<PCGEx::FCurveLUT> WeightLUT;
 
 	PCGEX_FOREACH_FIELD_NEARESTPOLYLINE(PCGEX_OUTPUT_DECL_TOGGLE)
 };
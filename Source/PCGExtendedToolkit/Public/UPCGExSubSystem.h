@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "Graph/Data/PCGExClusterCache.h"
 #include "UPCGExSubSystem.generated.h"
 
 UCLASS()
@@ -12,4 +13,14 @@ class /*PCGEXTENDEDTOOLKIT_API*/ UPCGExSubSystem : public UWorldSubsystem
 public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
+
+	/** Clusters built in this world, kept across graph executions. Null if disabled in settings. Settings changes apply on the next request. */
+	TSharedPtr<PCGExClusterCache::FCache> GetClusterCache();
+
+	PCGExClusterCache::FStats GetClusterCacheStats() const;
+
+protected:
+	mutable FRWLock ClusterCacheLock;
+	TSharedPtr<PCGExClusterCache::FCache> ClusterCache;
+	int64 ClusterCacheBudgetBytes = 0;
 };